@@ -0,0 +1,83 @@
+#ifndef QC_LC29_COMMAND_H_INCLUDED
+#define QC_LC29_COMMAND_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Single-pass serializer for the commands sent to the module:
+
+    $<Header>,<Arg>,...,<Arg>*<Checksum><CR><LF>
+
+  The header and every argument are written exactly once, straight into the
+  caller's buffer. The checksum is folded in while the bytes are written and
+  the length is tracked along the way, so building a command neither rescans
+  the buffer nor goes through stdio.
+
+  Writes never go past size. Running out of room, or an argument holding a
+  char that would break the framing (',', '*', '$', <CR>, <LF>), fails the
+  command; lc29_command_end() then returns 0 and the buffer content is
+  undefined.
+*/
+
+/* Buffer size that holds every command the driver sends, '\0' included */
+#define LC29_CMD_MAX_LENGTH 50
+
+typedef struct {
+  char *buffer;
+  size_t size;
+  size_t length;
+  uint8_t checksum;
+  bool failed;
+} qc_lc29x_command_s;
+
+/* header is the sentence ID with its '$', e.g. "$PAIR050" */
+void lc29_command_begin(qc_lc29x_command_s *command, char *buffer, size_t size,
+                        const char *header);
+void lc29_command_arg(qc_lc29x_command_s *command, const char *arg);
+void lc29_command_arg_uint(qc_lc29x_command_s *command, uint32_t value);
+void lc29_command_arg_int(qc_lc29x_command_s *command, int32_t value);
+/*
+  Appends *<Checksum><CR><LF> and a terminating '\0'. Returns the length of
+  the command without the '\0', 0 when it failed.
+*/
+size_t lc29_command_end(qc_lc29x_command_s *command);
+
+/*
+  Commands without arguments or with fixed ones. They are kept as complete
+  frames, checksum and <CR><LF> included, and written as they are.
+*/
+typedef enum {
+  LC29_FRAME_GNSS_POWER_ON,
+  LC29_FRAME_GNSS_POWER_OFF,
+  LC29_FRAME_HOT_START,
+  LC29_FRAME_WARM_START,
+  LC29_FRAME_COLD_START,
+  LC29_FRAME_FULL_COLD_START,
+  LC29_FRAME_NVM_SAVE_SETTING,
+  LC29_FRAME_GET_FIX_RATE,
+  LC29_FRAME_GET_MIN_SNR,
+  LC29_FRAME_GET_GNSS_SEARCH_MODE,
+  LC29_FRAME_GET_STATIC_THRESHOLD,
+  LC29_FRAME_GET_NAVIGATION_MODE,
+  LC29_FRAME_GET_NMEA_POS_DECIMAL_PRECISION,
+  LC29_FRAME_GET_NMEA_OUTPUT_MODE,
+  LC29_FRAME_GET_DUAL_BAND,
+  LC29_FRAME_GET_SBAS_STATUS,
+  LC29_FRAME_GET_EASY_STATUS,
+  LC29_FRAME_GET_UART0_BAUDRATE,
+  LC29_FRAME_DR_SAVE_SETTINGS,
+  LC29_FRAME_DR_GET_PQTM_MESSAGE_CONFIG,
+  LC29_FRAME_COUNT
+} qc_lc29x_frame_id_t;
+
+typedef struct {
+  const char *data;
+  uint8_t length;
+  int16_t cmd_id; // PAIR number the PAIR_ACK carries, -1 for PQTM commands
+} qc_lc29x_frame_s;
+
+extern const qc_lc29x_frame_s lc29_command_frames[LC29_FRAME_COUNT];
+
+#endif
@@ -1,7 +1,10 @@
 #ifndef QC_LC29_DRIVER_H_INCLUDED
 #define QC_LC29_DRIVER_H_INCLUDED
 
+#include "qc_lc29_command.h"
+#include "qc_lc29_framer.h"
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -64,9 +67,14 @@
 #define PAIR_QUERY_STATIC_THRESHOLD_ARGS 1
 #define PAIR_QUERY_NAVIGATION_MODE_ARGS 1
 #define PAIR_QUERY_NMEA_DECIMAL_PRECISION_ARGS 1
+#define PAIR_QUERY_NMEA_OUTPUT_MODE_ARGS 2
 #define PAIR_QUERY_DUAL_BAND_MODE_ARGS 1
 #define PAIR_QUERY_SBAS_STATUS_ARGS 1
-#define PAIR_QUERY_EASY_STATUS_ARGS 1
+#define PAIR_QUERY_EASY_STATUS_ARGS 2
+/* <Status> is left out while EASY is disabled */
+#define PAIR_QUERY_EASY_STATUS_MIN_ARGS 1
+/* Most values a query result handed to a command callback can carry */
+#define PAIR_QUERY_MAX_ARGS 10
 
 #define LC29_BAUD_RATE_4800 4800
 #define LC29_BAUD_RATE_9600 9600
@@ -119,6 +127,50 @@ typedef struct {
   qc_lc29x_driver_response_t (*config)(unsigned char config);
 } qc_lc29x_driver_interface_s;
 
+/*
+  Transport interface, v2 of the callbacks given to Lc29_driver_ctor(). Every
+  callback gets the context handed to Lc29_driver_ctor_transport(), so several
+  modules can be driven from one process without a global per UART.
+
+  timeout_ms: 0 returns right away (non-blocking), > 0 waits at most that long
+  for data (read) or for room (write), < 0 blocks until something happens.
+  read/write return the number of bytes transferred (0 when the timeout
+  expired) or a negative value on error. read does not null terminate.
+  init and config are optional.
+*/
+typedef struct {
+  qc_lc29x_driver_response_t (*init)(void *ctx);
+  int (*write)(void *ctx, const char *data, size_t length, int timeout_ms);
+  int (*read)(void *ctx, char *data, size_t length, int timeout_ms);
+  qc_lc29x_driver_response_t (*config)(void *ctx, char config);
+} qc_lc29x_transport_s;
+
+/*
+  Storage for one driver instance without the heap. LC29_DRIVER_STORAGE_SIZE
+  is an upper bound of lc29_driver_size() checked when the driver is built, so
+  the storage can be declared statically:
+
+    static qc_lc29x_driver_storage_t gnss_storage;
+    driver = Lc29_driver_ctor_static(&gnss_storage, sizeof(gnss_storage),
+                                     &uart_transport, &uart);
+*/
+#define LC29_DRIVER_STORAGE_SIZE 4096
+
+typedef union {
+  max_align_t align;
+  unsigned char bytes[LC29_DRIVER_STORAGE_SIZE];
+} qc_lc29x_driver_storage_t;
+
+/*
+  Fixed capacity set of driver instances carved out of caller provided
+  storage. Free slots are chained through the instances themselves.
+*/
+typedef struct {
+  qc_lc29_driver_s *free_list;
+  size_t capacity;
+  size_t available;
+} qc_lc29x_driver_pool_s;
+
 typedef enum {
   CMD_SEND_SUCCESS = 0,
   COMAND_BEING_PROCESSED,
@@ -127,6 +179,7 @@ typedef enum {
   CMD_ID_NOT_SUPPORTED,
   CMD_PARAM_ERROR,
   MNL_SERVICE_BUSY,
+  CMD_QUEUE_FULL, // not from the module: every pending command slot is in use
 } qc_lc29x_ack_reponse_t;
 
 typedef enum { ONE_HZ = 1000, FIVE_HZ = 500, TEN_HZ = 100 } qc_lc29x_fix_rate_t;
@@ -231,7 +284,8 @@ typedef enum {
   LC_RESPONSE_INVALID_R_N,
   LC_RESPONSE_INVALID_IDENTIFIER,
   LC_RESPONSE_NO_CHECKSUM,
-  LC_RESPONSE_INVALID_CHECKSUM
+  LC_RESPONSE_INVALID_CHECKSUM,
+  LC_RESPONSE_INVALID_FIELDS // wrong command ID, value count or value type
 } qc_lc29x_response_error_t;
 
 typedef enum { PQTM_INS, PQTM_IMU, PQTM_GPS } qc_lc29x_dr_message_id_t;
@@ -269,6 +323,26 @@ typedef struct {
   qc_lc29x_pqtm_custom_message_output_t dr_vehicle_motion;
 } qc_lc29x_pqtm_custom_message_settings_t;
 
+/*
+  Receives the sentences of one class as they come out of the framer. The view
+  is only valid for the duration of the call, and the handler must not send
+  commands through the driver.
+*/
+typedef void (*qc_lc29x_sentence_handler_t)(
+    void *context, const qc_lc29x_sentence_view_s *sentence);
+
+/*
+  Completion of a command submitted with lc29_driver_submit_cmd() or
+  lc29_driver_submit_query(). query_values holds the parsed query result
+  (num_values is 0 for SET commands or when the command failed) and is only
+  valid for the duration of the call. New commands may be submitted from the
+  callback.
+*/
+typedef void (*qc_lc29x_command_callback_t)(void *context, int cmd_id,
+                                            qc_lc29x_ack_reponse_t result,
+                                            const int *query_values,
+                                            int num_values);
+
 /* LC29 Driver Generic Methods */
 qc_lc29_driver_s *Lc29_driver_ctor(
     qc_lc29x_driver_response_t (*lc29_driver_hw_init)(void),
@@ -276,27 +350,118 @@ qc_lc29_driver_s *Lc29_driver_ctor(
     qc_lc29x_driver_response_t (*lc29_driver_read)(char *data, int length),
     qc_lc29x_driver_response_t (*lc29_driver_config)(char config));
 
-qc_lc29x_ack_reponse_t lc29_driver_parse_response(char *response_string,
+qc_lc29_driver_s *
+Lc29_driver_ctor_transport(const qc_lc29x_transport_s *transport, void *ctx);
+qc_lc29_driver_s *Lc29_driver_ctor_static(void *storage, size_t size,
+                                          const qc_lc29x_transport_s *transport,
+                                          void *ctx);
+void Lc29_driver_dtor(qc_lc29_driver_s *driver);
+size_t lc29_driver_size(void);
+size_t lc29_driver_alignment(void);
+
+size_t lc29_driver_pool_init(qc_lc29x_driver_pool_s *pool,
+                             qc_lc29x_driver_storage_t *slots, size_t count);
+qc_lc29_driver_s *Lc29_driver_pool_ctor(qc_lc29x_driver_pool_s *pool,
+                                        const qc_lc29x_transport_s *transport,
+                                        void *ctx);
+
+qc_lc29x_driver_response_t
+lc29_driver_set_sentence_handler(qc_lc29_driver_s *driver,
+                                 qc_lc29x_sentence_class_t sentence_class,
+                                 qc_lc29x_sentence_handler_t handler,
+                                 void *context);
+qc_lc29x_driver_response_t lc29_driver_poll(qc_lc29_driver_s *driver);
+void lc29_driver_feed(qc_lc29_driver_s *driver, const char *data,
+                      size_t length);
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_cmd(qc_lc29_driver_s *driver, char *cmd_payload, int cmd_id,
+                       qc_lc29x_command_callback_t callback, void *context);
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_query(qc_lc29_driver_s *driver, char *cmd_payload,
+                         int cmd_id, const char *query_id, int query_num_args,
+                         qc_lc29x_command_callback_t callback, void *context);
+qc_lc29x_ack_reponse_t lc29_driver_send_constant(qc_lc29_driver_s *driver,
+                                                 qc_lc29x_frame_id_t frame_id);
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_constant(qc_lc29_driver_s *driver,
+                            qc_lc29x_frame_id_t frame_id, const char *query_id,
+                            int query_num_args,
+                            qc_lc29x_command_callback_t callback,
+                            void *context);
+uint8_t lc29_driver_pending_cmds(const qc_lc29_driver_s *driver);
+qc_lc29x_dec_accuracy_t
+lc29_driver_decimal_accuracy(const qc_lc29_driver_s *driver);
+qc_lc29x_fix_rate_t lc29_driver_fix_interval(const qc_lc29_driver_s *driver);
+const qc_lc29x_nmea_output_rate_s *
+lc29_driver_nmea_output_rates(const qc_lc29_driver_s *driver);
+const qc_lc29x_pqtm_output_rate_settings_t *
+lc29_driver_dr_output_rates(const qc_lc29_driver_s *driver);
+/*
+  Millisecond clock for command deadlines. Required by the lc29_driver_submit_*
+  functions, which refuse commands (CMD_INVALID) without one; otherwise an
+  unanswered command would keep its pending slot forever. The blocking
+  setters and getters work without a clock, they count reads instead.
+*/
+qc_lc29x_driver_response_t
+lc29_driver_set_clock(qc_lc29_driver_s *driver, uint32_t (*clock_ms)(void));
+
+qc_lc29x_ack_reponse_t lc29_driver_parse_response(const char *response_string,
                                                   int command_id);
-qc_lc29x_ack_reponse_t lc29_driver_parse_query_response(char *response_string,
-                                                        char *command_id,
-                                                        int response_string_len,
-                                                        int response_num_args,
-                                                        int *parsed_query);
-
-qc_lc29x_response_error_t lc29_driver_validate_string(char *pair_id,
+qc_lc29x_ack_reponse_t
+lc29_driver_parse_query_response(const char *response_string,
+                                 const char *command_id,
+                                 int response_string_len,
+                                 int response_num_args, int *parsed_query);
+
+/*
+  Reentrant, non-modifying parsers for one response of length bytes. All state
+  is on the stack, they can run on several threads at once. See
+  qc_lc29x_response_error_t for why a sentence is refused.
+*/
+qc_lc29x_response_error_t
+lc29_driver_parse_cmd_response(const char *response, size_t length,
+                               int command_id, qc_lc29x_ack_reponse_t *result);
+qc_lc29x_response_error_t
+lc29_driver_parse_query_result(const char *response, size_t length,
+                               const char *command_id, int response_num_args,
+                               int *parsed_query);
+
+qc_lc29x_response_error_t lc29_driver_validate_string(const char *pair_id,
                                                       const char *sentence,
                                                       size_t length,
                                                       int check_checksum);
 uint8_t lc29_driver_response_has_checksum(const char *sentence, size_t length);
 uint8_t lc29_driver_get_checksum(const char *sentence);
-// qc_lc29x_response_error_t lc29_driver_transmit_cmd(char *cmd_payload,
-//                                                    char *driver_cmd_response,
-//                                                    uint16_t cmd_id);
 qc_lc29x_ack_reponse_t lc29_driver_nvm_save_setting(qc_lc29_driver_s *driver,
                                                     bool enable);
 
-/* LC29H Driver Setter Methods */
+/*
+  LC29H Driver Setter Methods
+
+  The typed setters range-check their value and write it straight into the
+  command. The char * forms are kept for existing callers and wrap them.
+*/
+qc_lc29x_ack_reponse_t lc29_driver_set_fix_interval(qc_lc29_driver_s *driver,
+                                                    uint16_t interval_ms);
+qc_lc29x_ack_reponse_t lc29_driver_set_min_snr_dbhz(qc_lc29_driver_s *driver,
+                                                    uint8_t min_snr);
+qc_lc29x_ack_reponse_t
+lc29_driver_set_nmea_output_interval(qc_lc29_driver_s *driver,
+                                     qc_lc29x_nmea_output_rate_id_t rate_id,
+                                     uint8_t output_rate);
+qc_lc29x_ack_reponse_t
+lc29_driver_set_static_threshold_dms(qc_lc29_driver_s *driver,
+                                     uint8_t speed_threshold);
+qc_lc29x_ack_reponse_t lc29_driver_set_rtc_wakeup(qc_lc29_driver_s *driver,
+                                                  uint32_t wakeup_time);
+qc_lc29x_ack_reponse_t lc29_driver_set_uart_baud_rate(qc_lc29_driver_s *driver,
+                                                      uint8_t port_index,
+                                                      uint32_t baud_rate);
+qc_lc29x_ack_reponse_t
+lc29_driver_set_pqtm_message_output(qc_lc29_driver_s *driver, bool ins_enabled,
+                                    bool imu_enabled, bool gps_enabled,
+                                    uint8_t rate_hz);
+
 qc_lc29x_ack_reponse_t lc29_driver_set_fix_rate(qc_lc29_driver_s *driver,
                                                 char *fix_rate);
 qc_lc29x_ack_reponse_t lc29_driver_set_min_snr(qc_lc29_driver_s *driver,
@@ -325,13 +490,23 @@ qc_lc29x_ack_reponse_t
 lc29_driver_get_gnss_search_mode(qc_lc29_driver_s *driver);
 qc_lc29x_ack_reponse_t
 lc29_driver_get_navigation_mode(qc_lc29_driver_s *driver);
+qc_lc29x_ack_reponse_t
+lc29_driver_get_static_threshold(qc_lc29_driver_s *driver);
+qc_lc29x_ack_reponse_t
+lc29_driver_get_NMEA_decimal_precision(qc_lc29_driver_s *driver);
+qc_lc29x_ack_reponse_t
+lc29_driver_get_nmea_output_mode(qc_lc29_driver_s *driver);
+qc_lc29x_ack_reponse_t lc29_driver_get_sbas_mode(qc_lc29_driver_s *driver);
+qc_lc29x_ack_reponse_t lc29_driver_get_easy_satus(qc_lc29_driver_s *driver);
+qc_lc29x_ack_reponse_t lc29_driver_get_baudrate(qc_lc29_driver_s *driver);
 qc_lc29x_ack_reponse_t lc29_driver_get_dual_band_mode(qc_lc29_driver_s *driver);
 
 /* LC29H DR & RTK Message Structure */
 qc_lc29x_ack_reponse_t
-lc29_driver_parse_dr_cmd_response(char *response_string,
-                                  int response_string_len, char *dr_cmd_id,
-                                  int dr_cmd_id_len, int check_checksum);
+lc29_driver_parse_dr_cmd_response(const char *response_string,
+                                  int response_string_len,
+                                  const char *dr_cmd_id, int dr_cmd_id_len,
+                                  int check_checksum);
 qc_lc29x_ack_reponse_t
 lc29_driver_set_dr_rtk_message_output(qc_lc29_driver_s *driver, char *msg_type,
                                       bool msg_type_output_state);
@@ -2,8 +2,152 @@
 #define QC_LC29_DRIVER_INTERNAL_H_INCLUDED
 
 #include "qc_lc29_driver.h"
+#include "qc_lc29_framer.h"
 #include <stdbool.h>
 
+/* Scratch buffer handed to the read callback, any number of sentences fit */
+#define LC29_DRIVER_READ_CHUNK_SIZE 256
+/* Longest a blocking command waits on a single read or write */
+#define LC29_DRIVER_IO_TIMEOUT_MS 100
+/* Reads allowed without the awaited sentence before a command gives up */
+#define LC29_DRIVER_MAX_READ_ATTEMPTS 32
+
+/* Commands that can be in flight at the same time */
+#define LC29_DRIVER_MAX_PENDING_CMDS 8
+/* Time allowed for the first PAIR_ACK of a command */
+#define LC29_DRIVER_ACK_TIMEOUT_MS 1000
+/* Time allowed for the final PAIR_ACK after a result 1 (being processed) */
+#define LC29_DRIVER_PROCESSING_TIMEOUT_MS 10000
+
+typedef enum {
+  LC29_CMD_FREE,
+  LC29_CMD_AWAIT_ACK,
+  LC29_CMD_AWAIT_RESULT
+} qc_lc29x_cmd_state_t;
+
+typedef struct {
+  qc_lc29x_cmd_state_t state;
+  int cmd_id;
+  const char *query_id;      // NULL for SET commands
+  uint8_t query_sentence_id; // qc_lc29x_sentence_id_t of query_id
+  int query_num_args;
+  int query_min_args;   // trailing values the result may leave out
+  bool processing;      // result 1 received, waiting for the final PAIR_ACK
+  uint32_t deadline_ms; // only enforced when the driver has a clock
+  uint32_t sequence;    // submission order, answers of one ID come back in it
+  qc_lc29x_command_callback_t callback;
+  void *context;
+} qc_lc29x_pending_cmd_s;
+
+/* PAIR and PQTM commands of the registry, see lc29_pair_cmds */
+typedef enum {
+  LC29_PAIR_SET_FIX_RATE,
+  LC29_PAIR_GET_FIX_RATE,
+  LC29_PAIR_SET_MIN_SNR,
+  LC29_PAIR_GET_MIN_SNR,
+  LC29_PAIR_SET_NMEA_OUTPUT_RATE,
+  LC29_PAIR_GET_NMEA_OUTPUT_RATE,
+  LC29_PAIR_SET_GNSS_SEARCH_MODE,
+  LC29_PAIR_GET_GNSS_SEARCH_MODE,
+  LC29_PAIR_SET_STATIC_THRESHOLD,
+  LC29_PAIR_GET_STATIC_THRESHOLD,
+  LC29_PAIR_SET_NAVIGATION_MODE,
+  LC29_PAIR_GET_NAVIGATION_MODE,
+  LC29_PAIR_SET_NMEA_POS_DECIMAL_PRECISION,
+  LC29_PAIR_GET_NMEA_POS_DECIMAL_PRECISION,
+  LC29_PAIR_SET_NMEA_OUTPUT_MODE,
+  LC29_PAIR_GET_NMEA_OUTPUT_MODE,
+  LC29_PAIR_SET_DUAL_BAND,
+  LC29_PAIR_GET_DUAL_BAND,
+  LC29_PAIR_SET_SBAS,
+  LC29_PAIR_GET_SBAS_STATUS,
+  LC29_PAIR_SET_EASY,
+  LC29_PAIR_GET_EASY_STATUS,
+  LC29_PAIR_NVM_SAVE_SETTING,
+  LC29_PAIR_ENTER_RTC_MODE,
+  LC29_PAIR_SET_BAUDRATE,
+  LC29_PAIR_GET_BAUDRATE,
+  LC29_PAIR_SET_CUSTOM_MSG_OUTPUT,
+  LC29_PAIR_GET_CUSTOM_MSG_OUTPUT,
+  LC29_PQTM_SET_MESSAGE_OUTPUT,
+  LC29_PQTM_GET_MESSAGE_OUTPUT,
+  LC29_PAIR_CMD_COUNT
+} qc_lc29x_pair_cmd_t;
+
+/* Value types of the command registry, each one has its own valid range */
+typedef enum {
+  LC29_ARG_ZERO, // reserved, always 0
+  LC29_ARG_ONE,  // <Type> of a PQTM SET, always 1
+  LC29_ARG_BOOL,
+  LC29_ARG_FIX_INTERVAL,      // 100–1000 ms
+  LC29_ARG_MIN_SNR,           // 9–49 dB-Hz
+  LC29_ARG_NMEA_TYPE,         // qc_lc29x_nmea_output_rate_id_t
+  LC29_ARG_NMEA_RATE,         // 0–20 position fixes
+  LC29_ARG_SPEED_THRESHOLD,   // 0–20 dm/s
+  LC29_ARG_NAV_MODE,          // qc_lc29x_nav_mode_t without the reserved codes
+  LC29_ARG_DECIMAL_PRECISION, // qc_lc29x_dec_accuracy_t
+  LC29_ARG_NMEA_MODE,         // qc_nmea_output_mode
+  LC29_ARG_RTC_SECONDS,       // 0 or 10–62208000 s
+  LC29_ARG_PORT_INDEX,
+  LC29_ARG_BAUD_RATE,    // one of LC29_BAUD_RATE_*
+  LC29_ARG_CUSTOM_MSG,   // qc_lc29x_dr_custom_message_id_t
+  LC29_ARG_PQTM_RATE,    // 1, 2, 4, 5, 10, 20, 50 or 100 Hz
+  LC29_ARG_TYPE_COUNT
+} qc_lc29x_arg_type_t;
+
+/* Most arguments a registered command takes */
+#define LC29_PAIR_MAX_ARGS 6
+
+/* Flags of qc_lc29x_pair_cmd_desc_s::state_flags */
+#define LC29_STATE_BOOL 0x01    // the field is a bool, any non zero is true
+#define LC29_STATE_INDEXED 0x02 // value 0 selects the element of an array
+
+/*
+  One PAIR command of the registry. lc29_driver_execute() checks the arguments
+  against their types, builds the command (or takes its constant frame), waits
+  for the PAIR_ACK and the query result and then copies state_count of the
+  arguments (SET) or query values (GET), from state_first on, into the driver
+  field at state_offset. Indexed state is an array of state_stride byte
+  elements, e.g. the NMEA output rate of each sentence type. State that one
+  run of values cannot describe is kept by the keep hook instead, which gets
+  the values that were actually received.
+
+  PQTM commands have cmd_id -1: instead of a PAIR_ACK they are answered by
+  $<header>OK (or ERROR), followed by the query result for a GET.
+*/
+typedef struct {
+  const char *header; // also the identifier of the query result
+  const char *query_header; // identifier of the query result, NULL for header
+  int16_t cmd_id;
+  uint8_t frame;       // qc_lc29x_frame_id_t, LC29_FRAME_COUNT when built
+  uint8_t num_args;    // arguments appended to the header
+  uint8_t query_num_args; // values of the query result, 0 for SET commands
+  uint8_t query_min_args; // fewer values accepted, 0 when all are required
+  uint8_t args[LC29_PAIR_MAX_ARGS]; // qc_lc29x_arg_type_t of each argument
+  uint8_t state_first;
+  uint8_t state_count; // 0 when the command keeps no state
+  uint8_t state_flags;
+  uint8_t state_size;
+  uint8_t state_stride;
+  uint16_t state_offset;
+  void (*keep)(qc_lc29_driver_s *driver, const int *values, int num_values);
+} qc_lc29x_pair_cmd_desc_s;
+
+extern const qc_lc29x_pair_cmd_desc_s lc29_pair_cmds[LC29_PAIR_CMD_COUNT];
+
+/* Where the instance lives, decides what Lc29_driver_dtor() gives it back to */
+typedef enum {
+  LC29_STORAGE_HEAP,
+  LC29_STORAGE_STATIC,
+  LC29_STORAGE_POOL,
+  LC29_STORAGE_POOL_FREE // pool slot on the free list, not handed out
+} qc_lc29x_storage_t;
+
+typedef struct {
+  qc_lc29x_sentence_handler_t handler;
+  void *context;
+} qc_lc29x_sentence_handler_s;
+
 struct qc_lc29_driver_s {
   qc_lc29x_fix_rate_t fix_rate;
   uint16_t min_snr;
@@ -26,13 +170,23 @@ struct qc_lc29_driver_s {
   uint32_t low_pwr_rtc_clk;
   qc_lc29x_periodic_sleep_mode_t sleep_mode; // Disable is default setting
   qc_lc29x_pps_setting_t pps_pin_setting;
-  uint16_t baud_rate;
+  uint32_t baud_rate;
   qc_lc29x_pqtm_output_rate_settings_t dr_rtk_output_rate;
   qc_lc29x_pqtm_custom_message_settings_t dr_rtk_custom_message_settings;
   qc_lc29x_driver_response_t (*lc29_driver_hw_init)(void);
   qc_lc29x_driver_response_t (*lc29_driver_write)(char *data, int length);
   qc_lc29x_driver_response_t (*lc29_driver_read)(char *data, int length);
   qc_lc29x_driver_response_t (*lc29_driver_config)(char config);
+  qc_lc29x_transport_s transport;
+  void *transport_ctx;
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_handler_s handlers[LC29_SENTENCE_CLASS_COUNT];
+  qc_lc29x_pending_cmd_s pending_cmds[LC29_DRIVER_MAX_PENDING_CMDS];
+  uint32_t next_sequence;
+  uint32_t (*lc29_driver_clock_ms)(void);
+  qc_lc29x_storage_t storage;
+  qc_lc29x_driver_pool_s *pool; // owning pool, also links free pool slots
+  qc_lc29_driver_s *pool_next;
 };
 
 qc_lc29_driver_s *lc29_driver_init(
@@ -42,8 +196,40 @@ qc_lc29_driver_s *lc29_driver_init(
     qc_lc29x_driver_response_t (*lc29_driver_read)(char *data, int length),
     qc_lc29x_driver_response_t (*lc29_driver_config)(char config));
 
-int lc29_driver_parse_string_by_comma(int cmd_id_len, char *string, int *values,
-                                      int max_values);
+qc_lc29_driver_s *
+lc29_driver_init_transport(qc_lc29_driver_s *driver,
+                           const qc_lc29x_transport_s *transport, void *ctx);
+
+qc_lc29x_driver_response_t lc29_driver_write_all(qc_lc29_driver_s *driver,
+                                                 const char *data,
+                                                 size_t length);
+
 char *Lc29_driver_crop_sentence(char *sentence, size_t length);
+size_t lc29_driver_line_length(const char *sentence, size_t length);
+
+qc_lc29x_ack_reponse_t
+lc29_driver_parse_ack_sentence(const qc_lc29x_sentence_view_s *sentence,
+                               int command_id);
+qc_lc29x_ack_reponse_t
+lc29_driver_parse_query_sentence(const qc_lc29x_sentence_view_s *sentence,
+                                 const char *command_id, int response_num_args,
+                                 int *parsed_query);
+
+void lc29_driver_dispatch(qc_lc29_driver_s *driver,
+                          qc_lc29x_sentence_class_t sentence_class);
+void lc29_driver_process_responses(qc_lc29_driver_s *driver);
+qc_lc29x_driver_response_t
+lc29_driver_read_sentence(qc_lc29_driver_s *driver,
+                          qc_lc29x_sentence_class_t sentence_class,
+                          qc_lc29x_sentence_view_s *sentence);
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_frame(qc_lc29_driver_s *driver, const char *frame,
+                         size_t length, int cmd_id, const char *query_id,
+                         int query_num_args,
+                         qc_lc29x_command_callback_t callback, void *context,
+                         qc_lc29x_pending_cmd_s **slot);
+qc_lc29x_ack_reponse_t lc29_driver_execute(qc_lc29_driver_s *driver,
+                                           qc_lc29x_pair_cmd_t cmd,
+                                           const uint32_t *args);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef QC_LC29_EPOCH_H_INCLUDED
+#define QC_LC29_EPOCH_H_INCLUDED
+
+#include "qc_lc29_driver.h"
+#include "qc_lc29_nmea.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Epoch assembler: merges the sentences the module sends for one fix (RMC,
+  VTG, GGA, the GSAs, the GSV sequences and the DR solution) into a single
+  solution and hands it to the consumer once per fix, instead of waking it
+  for every sentence.
+
+  A fix starts with the first time stamped sentence (GGA, RMC) carrying a new
+  UTC time, or with a second GGA, RMC or VTG when the time is missing. The
+  sentence that came last before such a start is remembered as the one that
+  closes a fix; from the next fix on the solution is published as soon as
+  that sentence arrives, without waiting for the next fix to begin. A
+  sentence showing up after its fix was published (the output changed) is
+  merged but not published again, the closing sentence is learned anew when
+  the next fix starts.
+
+  $PQTMINS runs on its own clock; the latest one received before a fix is
+  published goes out with it.
+*/
+
+/* Parts of an epoch, as bits of qc_lc29x_epoch_s.parts and .expected */
+typedef enum {
+  LC29_EPOCH_GGA = 1 << 0,
+  LC29_EPOCH_RMC = 1 << 1,
+  LC29_EPOCH_GSA = 1 << 2,
+  LC29_EPOCH_GSV = 1 << 3,
+  LC29_EPOCH_VTG = 1 << 4,
+  LC29_EPOCH_INS = 1 << 5
+} qc_lc29x_epoch_part_t;
+
+/*
+  One fix. Only the parts with their bit set in parts were received, the
+  others hold whatever the previous fix left. complete is set when every part
+  the module is configured to send each fix (expected) is there.
+*/
+typedef struct {
+  uint64_t utc_epoch_ns; // RMC time and date, 0 without a date
+  uint32_t utc_time_ms;  // GGA or RMC time of day
+  uint16_t parts;        // qc_lc29x_epoch_part_t bits received
+  uint16_t expected;     // qc_lc29x_epoch_part_t bits sent every fix
+  bool has_time;
+  bool complete;
+  qc_lc29x_gga_s gga;
+  qc_lc29x_rmc_s rmc;
+  qc_lc29x_vtg_s vtg;
+  qc_lc29x_gsa_s gsa;
+  qc_lc29x_gsv_table_s gsv;
+  qc_lc29x_pqtm_ins_s ins;
+} qc_lc29x_epoch_s;
+
+/*
+  Receives every assembled epoch. The epoch is only valid for the duration of
+  the call.
+*/
+typedef void (*qc_lc29x_epoch_callback_t)(void *context,
+                                          const qc_lc29x_epoch_s *epoch);
+
+typedef struct {
+  qc_lc29x_epoch_s epoch; // being assembled
+  qc_lc29x_pqtm_ins_s ins;
+  qc_lc29x_date_cache_s date_cache;
+  qc_lc29x_dec_accuracy_t precision;
+  qc_lc29x_epoch_callback_t callback;
+  void *context;
+  uint32_t closing;    // signature of the sentence that ends a fix, 0 unknown
+  uint32_t last;       // signature of the last sentence merged
+  bool published;      // epoch already handed out
+  bool has_ins;        // ins received since the last epoch was published
+  uint32_t epochs;     // published
+  uint32_t incomplete; // published without every expected part
+  uint32_t late;       // sentences that came after their epoch was published
+  uint32_t errors;     // sentences that failed to decode
+} qc_lc29x_epoch_assembler_s;
+
+/*
+  expected is the set of qc_lc29x_epoch_part_t the module sends every fix,
+  precision its PAIR098 setting. lc29_epoch_configure() takes both from what
+  the driver knows about the module instead.
+*/
+void lc29_epoch_init(qc_lc29x_epoch_assembler_s *assembler, uint16_t expected,
+                     qc_lc29x_dec_accuracy_t precision,
+                     qc_lc29x_epoch_callback_t callback, void *context);
+void lc29_epoch_configure(qc_lc29x_epoch_assembler_s *assembler,
+                          const qc_lc29_driver_s *driver);
+
+/*
+  Configures the assembler from the driver and installs it as the handler of
+  the NMEA and PQTM sentence classes. Call lc29_epoch_configure() again after
+  changing the output rates through the driver.
+*/
+qc_lc29x_driver_response_t
+lc29_epoch_attach(qc_lc29x_epoch_assembler_s *assembler,
+                  qc_lc29_driver_s *driver);
+
+/*
+  Merges one sentence. Sentences that are no part of an epoch (GLL, other
+  PQTM output) are ignored with LC29_NMEA_WRONG_SENTENCE.
+*/
+qc_lc29x_nmea_result_t
+lc29_epoch_feed(qc_lc29x_epoch_assembler_s *assembler,
+                const qc_lc29x_sentence_view_s *sentence);
+
+/* Publishes the epoch in progress now, e.g. when the UART goes idle */
+void lc29_epoch_flush(qc_lc29x_epoch_assembler_s *assembler);
+
+#endif
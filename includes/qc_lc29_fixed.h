@@ -0,0 +1,245 @@
+#ifndef QC_LC29_FIXED_H_INCLUDED
+#define QC_LC29_FIXED_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Fixed-point conversion kernels shared by the NMEA decoders and the typed
+  field accessors of the sentence parser.
+
+  Fields are turned straight into scaled integers, without atof, floating
+  point or a 64 bit multiply, which targets without a double precision FPU
+  would emulate in software. Every kernel takes the number of digits the
+  module is configured to send (PAIR098 decides the latitude/longitude and
+  altitude decimals), so a field laid out as expected is converted without
+  looking for its decimal point; any other layout still converts correctly
+  on a slower path.
+
+  The kernels are static inline so they fold into the decoders that call
+  them, with no call per field and the digit counts often known constants.
+*/
+
+static const uint32_t lc29_fixed_pow10[] = {
+    1,      10,      100,      1000,      10000,
+    100000, 1000000, 10000000, 100000000, 1000000000};
+
+/*
+  Exactly count (at most 9) digits. Digits are taken in pairs, which halves
+  the multiply-add chain the conversion waits on.
+*/
+static inline bool lc29_fixed_digits(const char *digits, uint8_t count,
+                                     uint32_t *value) {
+  uint32_t result = 0;
+  uint8_t invalid = 0;
+  uint8_t i = 0;
+
+  if (count & 1) {
+    result = (uint8_t)(digits[0] - '0');
+    invalid |= result > 9;
+    i = 1;
+  }
+  for (; i < count; i += 2) {
+    uint8_t high = (uint8_t)(digits[i] - '0');
+    uint8_t low = (uint8_t)(digits[i + 1] - '0');
+    invalid |= (high > 9) | (low > 9);
+    result = result * 100 + high * 10u + low;
+  }
+  *value = result;
+  return 0 == invalid;
+}
+
+/* Only digits, the decimals a conversion truncates are still checked */
+static inline bool lc29_fixed_all_digits(const char *field, uint8_t length) {
+  uint8_t invalid = 0;
+  for (uint8_t i = 0; i < length; i++) {
+    invalid |= (uint8_t)(field[i] - '0') > 9;
+  }
+  return 0 == invalid;
+}
+
+/* Unsigned integer of up to 10 digits that fits 32 bits */
+static inline bool lc29_fixed_uint32(const char *field, uint8_t length,
+                                     uint32_t *value) {
+  uint32_t high, low;
+
+  if (length <= 9) {
+    return length > 0 && lc29_fixed_digits(field, length, value);
+  }
+  if (10 != length || !lc29_fixed_digits(field, 9, &high) ||
+      !lc29_fixed_digits(&field[9], 1, &low) ||
+      high > (UINT32_MAX - low) / 10) {
+    return false;
+  }
+  *value = high * 10 + low;
+  return true;
+}
+
+/* Integer with an optional '-' that fits 32 bits */
+static inline bool lc29_fixed_int32(const char *field, uint8_t length,
+                                    int32_t *value) {
+  bool negative = length > 0 && '-' == field[0];
+  uint32_t magnitude;
+
+  if (!lc29_fixed_uint32(&field[negative], (uint8_t)(length - negative),
+                         &magnitude) ||
+      magnitude > (uint32_t)INT32_MAX + negative) {
+    return false;
+  }
+  *value = negative ? -(int32_t)(magnitude - 1) - 1 : (int32_t)magnitude;
+  return true;
+}
+
+/*
+  Decimal number with an optional '-', scaled by 10^scale. decimals is the
+  number of decimals the module writes (at most scale); with the point where
+  that puts it the digits are converted without scanning for it. Decimals
+  past scale are truncated. Empty fields and more than 9 significant digits
+  are rejected.
+*/
+static inline bool lc29_fixed_scaled(const char *field, uint8_t length,
+                                     uint8_t decimals, uint8_t scale,
+                                     int32_t *value) {
+  bool negative = length > 0 && '-' == field[0];
+  uint8_t start = negative ? 1 : 0;
+  uint8_t whole_digits;
+  uint32_t whole, fraction = 0, result;
+
+  // The layout the module is configured for
+  if (decimals > 0 && decimals <= scale && length > start + decimals &&
+      '.' == field[length - 1 - decimals] &&
+      length - 1 - decimals - start + scale <= 9) {
+    whole_digits = (uint8_t)(length - 1 - decimals - start);
+    if (!lc29_fixed_digits(&field[start], whole_digits, &whole) ||
+        !lc29_fixed_digits(&field[length - decimals], decimals, &fraction)) {
+      return false;
+    }
+    result = whole * lc29_fixed_pow10[scale] +
+             fraction * lc29_fixed_pow10[scale - decimals];
+    *value = negative ? -(int32_t)result : (int32_t)result;
+    return true;
+  }
+
+  // Any other layout, split at the point
+  whole_digits = 0;
+  while (start + whole_digits < length && '.' != field[start + whole_digits]) {
+    whole_digits++;
+  }
+  uint8_t point = start + whole_digits;
+  decimals = point < length ? (uint8_t)(length - point - 1) : 0;
+  if (decimals > scale) {
+    if (!lc29_fixed_all_digits(&field[point + 1 + scale], decimals - scale)) {
+      return false;
+    }
+    decimals = scale;
+  }
+  if (0 == whole_digits + decimals || whole_digits + scale > 9 ||
+      !lc29_fixed_digits(&field[start], whole_digits, &whole) ||
+      !lc29_fixed_digits(&field[point + 1], decimals, &fraction)) {
+    return false;
+  }
+
+  result = whole * lc29_fixed_pow10[scale] +
+           fraction * lc29_fixed_pow10[scale - decimals];
+  *value = negative ? -(int32_t)result : (int32_t)result;
+  return true;
+}
+
+/*
+  NMEA ddmm.mmmm (degree_digits 2) or dddmm.mmmm (3) coordinate with
+  minute_digits decimals expected, to 1e-7 degree. The minutes, scaled to
+  1e-7 minute, are divided down to degrees, which keeps every intermediate
+  inside 32 bits.
+*/
+static inline bool lc29_fixed_coordinate(const char *field, uint8_t length,
+                                         uint8_t degree_digits,
+                                         uint8_t minute_digits,
+                                         char hemisphere, int32_t *value) {
+  uint32_t degrees;
+  uint32_t minutes; // 1e-7 minute
+
+  if (length == degree_digits + 3 + minute_digits &&
+      '.' == field[degree_digits + 2]) {
+    uint32_t whole, decimals;
+    if (!lc29_fixed_digits(field, degree_digits, &degrees) ||
+        !lc29_fixed_digits(&field[degree_digits], 2, &whole) ||
+        !lc29_fixed_digits(&field[degree_digits + 3], minute_digits,
+                           &decimals)) {
+      return false;
+    }
+    minutes = (whole * lc29_fixed_pow10[minute_digits] + decimals) *
+              lc29_fixed_pow10[7 - minute_digits];
+  } else {
+    int32_t scaled;
+    if (length < degree_digits + 2 ||
+        !lc29_fixed_digits(field, degree_digits, &degrees) ||
+        '-' == field[degree_digits] ||
+        !lc29_fixed_scaled(&field[degree_digits], length - degree_digits, 7,
+                           7, &scaled)) {
+      return false;
+    }
+    minutes = (uint32_t)scaled;
+  }
+
+  if (minutes >= 600000000u || degrees > (2u == degree_digits ? 90u : 180u)) {
+    return false;
+  }
+
+  // Rounded to the nearest 1e-7 degree
+  int32_t result = (int32_t)(degrees * 10000000u + (minutes + 30) / 60);
+  switch (hemisphere) {
+  case 'N':
+  case 'E':
+    *value = result;
+    return true;
+  case 'S':
+  case 'W':
+    *value = -result;
+    return true;
+  default:
+    return false;
+  }
+}
+
+/*
+  Signed decimal degrees to 1e-7 degree, decimals past the seventh are
+  truncated. Whole degrees and decimals are converted separately, so 180
+  degrees with 7 decimals stays within 32 bits.
+*/
+static inline bool lc29_fixed_degrees(const char *field, uint8_t length,
+                                      uint32_t max_degrees, int32_t *value) {
+  bool negative = length > 0 && '-' == field[0];
+  uint8_t start = negative ? 1 : 0;
+  uint8_t whole_digits = 0;
+  uint32_t degrees, fraction = 0, result;
+
+  while (start + whole_digits < length && '.' != field[start + whole_digits]) {
+    whole_digits++;
+  }
+  if (0 == whole_digits || whole_digits > 3 ||
+      !lc29_fixed_digits(&field[start], whole_digits, &degrees)) {
+    return false;
+  }
+
+  uint8_t point = start + whole_digits;
+  uint8_t decimals = point < length ? (uint8_t)(length - point - 1) : 0;
+  if (decimals > 7) {
+    if (!lc29_fixed_all_digits(&field[point + 8], decimals - 7)) {
+      return false;
+    }
+    decimals = 7;
+  }
+  if (decimals > 0 &&
+      !lc29_fixed_digits(&field[point + 1], decimals, &fraction)) {
+    return false;
+  }
+
+  result = degrees * 10000000u + fraction * lc29_fixed_pow10[7 - decimals];
+  if (degrees > max_degrees || result > max_degrees * 10000000u) {
+    return false;
+  }
+  *value = negative ? -(int32_t)result : (int32_t)result;
+  return true;
+}
+
+#endif
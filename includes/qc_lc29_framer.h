@@ -0,0 +1,90 @@
+#ifndef QC_LC29_FRAMER_H_INCLUDED
+#define QC_LC29_FRAMER_H_INCLUDED
+
+#include "qc_lc29_parser.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Streaming sentence framer for the LC29H UART output.
+
+  Raw bytes are pushed in whatever chunks the transport delivers. The framer
+  stores them in a fixed-capacity ring buffer, discards anything outside a
+  `$ ... \n` frame and queues every complete sentence. Sentences are handed back
+  as views into the ring, so a single read can carry any number of sentences
+  without copying each one out.
+
+  Every stored byte also goes through the incremental parser, only sentences
+  with a valid checksum are queued and their field index comes along with the
+  view.
+*/
+
+/* Ring capacity, must be a power of two */
+#define LC29_FRAMER_CAPACITY 1024
+#define LC29_FRAMER_MASK (LC29_FRAMER_CAPACITY - 1)
+
+/* Number of complete sentences that can be queued across all classes */
+#define LC29_FRAMER_MAX_SENTENCES 32
+#define LC29_FRAMER_NO_ENTRY 0xFF
+
+/*
+  A complete sentence, from '$' up to and including the terminating '\n'.
+  data[length] is always '\0' so the view can be handed to the string based
+  parsers in place. The view stays valid until the next call into the framer.
+*/
+typedef struct {
+  char *data;
+  uint16_t length;
+  qc_lc29x_sentence_class_t sentence_class;
+  const qc_lc29x_sentence_info_s *info;
+} qc_lc29x_sentence_view_s;
+
+typedef struct {
+  uint32_t start;
+  uint16_t length;
+  uint8_t next;
+  qc_lc29x_sentence_info_s info;
+} qc_lc29x_framer_entry_s;
+
+typedef struct {
+  uint8_t head;
+  uint8_t tail;
+  uint8_t count;
+} qc_lc29x_framer_queue_s;
+
+/*
+  Complete sentences are sorted into one FIFO per sentence class, so the
+  command layer can pick up its PAIR_ACK while NMEA output queued before it is
+  still waiting for its handler. When the ring runs full the oldest queued
+  sentence, whatever its class, makes room for the new one.
+*/
+typedef struct {
+  /* Extra room past the ring lets a wrapped sentence be mirrored contiguous */
+  char buffer[LC29_FRAMER_CAPACITY + LC29_SENTENCE_MAX_LENGTH + 1];
+  uint32_t tail; // free running write position
+  uint32_t sentence_start;
+  qc_lc29x_parser_s parser;
+  qc_lc29x_framer_entry_s entries[LC29_FRAMER_MAX_SENTENCES];
+  uint8_t free_entry;
+  uint8_t entry_count;
+  qc_lc29x_framer_queue_s queues[LC29_SENTENCE_CLASS_COUNT];
+  uint32_t overruns; // queued sentences evicted because the ring was full
+  uint32_t dropped;  // truncated, malformed or unqueued sentences
+  uint32_t checksum_errors;
+} qc_lc29x_framer_s;
+
+void lc29_framer_init(qc_lc29x_framer_s *framer);
+bool lc29_framer_push_byte(qc_lc29x_framer_s *framer, char c);
+size_t lc29_framer_push(qc_lc29x_framer_s *framer, const char *data,
+                        size_t length);
+bool lc29_framer_next(qc_lc29x_framer_s *framer,
+                      qc_lc29x_sentence_view_s *sentence);
+bool lc29_framer_next_class(qc_lc29x_framer_s *framer,
+                            qc_lc29x_sentence_class_t sentence_class,
+                            qc_lc29x_sentence_view_s *sentence);
+uint8_t lc29_framer_pending(const qc_lc29x_framer_s *framer);
+uint8_t lc29_framer_pending_class(const qc_lc29x_framer_s *framer,
+                                  qc_lc29x_sentence_class_t sentence_class);
+
+#endif
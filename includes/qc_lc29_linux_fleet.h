@@ -0,0 +1,56 @@
+#ifndef QC_LC29_LINUX_FLEET_H_INCLUDED
+#define QC_LC29_LINUX_FLEET_H_INCLUDED
+
+#include "qc_lc29_driver.h"
+#include "qc_lc29_linux_serial.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Runs any number of LC29H modules from a single thread.
+
+  Every module gets its own driver on top of the Linux serial transport, all
+  tty fds are registered with one epoll instance and lc29_fleet_run_once()
+  drains the ready ones into their drivers. Commands are submitted with the
+  pipelined API (lc29_driver_submit_cmd/query) on lc29_fleet_driver() and
+  complete from the loop; their deadlines run off lc29_linux_clock_ms().
+
+  Member and driver storage is provided by the caller, one
+  qc_lc29x_driver_storage_t slot per member; the drivers are taken from a pool
+  over those slots, so the fleet never touches the heap.
+*/
+
+/* Ready fds handled per epoll_wait() */
+#define LC29_FLEET_MAX_EVENTS 64
+/* How often command deadlines are checked on idle members */
+#define LC29_FLEET_EXPIRY_INTERVAL_MS 10
+
+typedef struct {
+  qc_lc29x_linux_serial_s serial;
+  qc_lc29_driver_s *driver;
+  bool in_use;
+} qc_lc29x_fleet_member_s;
+
+typedef struct {
+  int epoll_fd;
+  qc_lc29x_fleet_member_s *members;
+  qc_lc29x_driver_pool_s pool;
+  size_t capacity;
+  size_t count;
+  uint32_t last_expiry_ms;
+} qc_lc29x_fleet_s;
+
+qc_lc29x_driver_response_t lc29_fleet_init(qc_lc29x_fleet_s *fleet,
+                                           qc_lc29x_fleet_member_s *members,
+                                           qc_lc29x_driver_storage_t *slots,
+                                           size_t capacity);
+int lc29_fleet_add(qc_lc29x_fleet_s *fleet, int fd, uint32_t baud_rate);
+int lc29_fleet_open(qc_lc29x_fleet_s *fleet, const char *path,
+                    uint32_t baud_rate);
+qc_lc29_driver_s *lc29_fleet_driver(qc_lc29x_fleet_s *fleet, int member);
+void lc29_fleet_remove(qc_lc29x_fleet_s *fleet, int member);
+int lc29_fleet_run_once(qc_lc29x_fleet_s *fleet, int timeout_ms);
+void lc29_fleet_close(qc_lc29x_fleet_s *fleet);
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef QC_LC29_LINUX_SERIAL_H_INCLUDED
+#define QC_LC29_LINUX_SERIAL_H_INCLUDED
+
+#include "qc_lc29_driver.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Linux tty transport for the LC29H driver.
+
+  The tty is put in raw mode and opened non-blocking, an epoll instance
+  (created on the first wait) waits for RX so a read returns as soon as the first byte of a sentence burst lands
+  instead of on VMIN/VTIME expiry. The serial low-latency flag is requested
+  where the tty driver supports it (not on ptys), which makes the kernel hand
+  every received byte to user space right away.
+
+  Either hand lc29_linux_serial_transport and the serial to
+  Lc29_driver_ctor_transport(), or run an RX loop around
+  lc29_linux_serial_poll() which drains everything received into the driver.
+*/
+
+/* Size of the stack buffer used to drain the tty */
+#define LC29_LINUX_SERIAL_DRAIN_SIZE 512
+
+typedef struct {
+  int fd;
+  int epoll_fd; // -1 until a read or lc29_linux_serial_poll() waits
+  bool owns_fd; // fd is closed by lc29_linux_serial_close()
+  bool low_latency;
+} qc_lc29x_linux_serial_s;
+
+extern const qc_lc29x_transport_s lc29_linux_serial_transport;
+
+qc_lc29x_driver_response_t
+lc29_linux_serial_open(qc_lc29x_linux_serial_s *serial, const char *path,
+                       uint32_t baud_rate);
+qc_lc29x_driver_response_t
+lc29_linux_serial_attach(qc_lc29x_linux_serial_s *serial, int fd,
+                         uint32_t baud_rate);
+void lc29_linux_serial_close(qc_lc29x_linux_serial_s *serial);
+
+int lc29_linux_serial_drain(qc_lc29x_linux_serial_s *serial,
+                            qc_lc29_driver_s *driver);
+int lc29_linux_serial_poll(qc_lc29x_linux_serial_s *serial,
+                           qc_lc29_driver_s *driver, int timeout_ms);
+
+uint32_t lc29_linux_clock_ms(void);
+
+#endif
@@ -0,0 +1,364 @@
+#ifndef QC_LC29_NMEA_H_INCLUDED
+#define QC_LC29_NMEA_H_INCLUDED
+
+#include "qc_lc29_driver.h"
+#include "qc_lc29_framer.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Decoders for the sentences the LC29H outputs.
+
+  Every decoder works in place on a framed sentence (the view handed to a
+  sentence handler), using the field index the parser built while the
+  sentence arrived. Numbers are converted straight from the digits into
+  scaled integers, nothing is copied, allocated or converted to floating
+  point.
+
+  Units:
+  - latitude/longitude: 1e-7 degree, north and east positive
+  - altitude, geoid separation: millimetre
+  - DOP values: 1/100
+  - speed: mm/s, course: 1/100 degree from true north
+  - UTC time of day: millisecond since midnight
+  - UTC epoch: nanosecond since 1970-01-01
+  - DR output (PQTM): attitude and heading 1/1000 degree, acceleration 1e-6 g,
+    angular rate 1e-6 degree/s, module timestamps millisecond, temperature
+    1/100 degree Celsius
+*/
+
+typedef enum {
+  LC29_NMEA_OK,
+  LC29_NMEA_WRONG_SENTENCE, // not the sentence type the decoder handles
+  LC29_NMEA_MISSING_FIELDS,
+  LC29_NMEA_INVALID_FIELD,
+  LC29_NMEA_OUT_OF_SEQUENCE // multi-sentence message part missing or repeated
+} qc_lc29x_nmea_result_t;
+
+typedef enum {
+  LC29_FIX_INVALID,
+  LC29_FIX_GPS,
+  LC29_FIX_DGPS,
+  LC29_FIX_PPS,
+  LC29_FIX_RTK_FIXED,
+  LC29_FIX_RTK_FLOAT,
+  LC29_FIX_DEAD_RECKONING
+} qc_lc29x_fix_quality_t;
+
+/*
+  $--GGA: fix data. Without a fix the module leaves time, position and
+  altitude empty, has_* tells which of them were present.
+*/
+typedef struct {
+  uint32_t utc_time_ms;
+  int32_t latitude;
+  int32_t longitude;
+  int32_t altitude_mm; // above mean sea level
+  int32_t geoid_separation_mm;
+  uint16_t hdop;
+  uint8_t fix_quality; // qc_lc29x_fix_quality_t
+  uint8_t num_satellites;
+  bool has_time;
+  bool has_position;
+  bool has_altitude;
+} qc_lc29x_gga_s;
+
+/*
+  precision is the PAIR098 setting the module runs with (see
+  lc29_driver_decimal_accuracy()). Coordinates laid out as that setting
+  prescribes take a fixed-width path, any other digit count is still decoded
+  correctly.
+*/
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_gga(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_dec_accuracy_t precision, qc_lc29x_gga_s *gga);
+
+/*
+  Start of the last UTC day an RMC date was converted for. Keep one per
+  module and hand it to every lc29_nmea_decode_rmc() call, the date is then
+  only converted when it changes.
+*/
+typedef struct {
+  uint32_t date; // ddmmyy as a number, UINT32_MAX when empty
+  uint64_t day_start_ns;
+} qc_lc29x_date_cache_s;
+
+/*
+  $--RMC: recommended minimum data. valid reflects the status field (A/V),
+  mode is the positioning mode indicator ('A', 'D', 'E', 'N', ...) or '\0'.
+  utc_epoch_ns needs both time and date, 0 otherwise.
+*/
+typedef struct {
+  uint64_t utc_epoch_ns;
+  uint32_t utc_time_ms;
+  int32_t latitude;
+  int32_t longitude;
+  uint32_t speed_mm_s;
+  uint16_t course_cdeg;
+  char mode;
+  bool valid;
+  bool has_time;
+  bool has_date;
+  bool has_position;
+  bool has_course;
+} qc_lc29x_rmc_s;
+
+/* $--VTG: course and speed over ground */
+typedef struct {
+  uint32_t speed_mm_s;
+  uint16_t course_cdeg;
+  char mode;
+  bool has_speed;
+  bool has_course;
+} qc_lc29x_vtg_s;
+
+/* Slots per qc_lc29x_constellation_t, MULTI collects unknown talkers */
+#define LC29_CONSTELLATION_COUNT (MULTI + 1)
+
+/* Dual band tracking of every constellation fits */
+#define LC29_GSV_MAX_SATELLITES 128
+#define LC29_GSV_UNKNOWN_ELEVATION INT8_MIN
+#define LC29_GSV_UNKNOWN_AZIMUTH UINT16_MAX
+
+/*
+  Satellites in view for one epoch, assembled from every $--GSV sequence the
+  module sends (one per constellation and signal). Stored as structure of
+  arrays, entry i of every array is the same satellite, so a pass over one
+  attribute is a linear scan the compiler can vectorize.
+
+  snr is 0 for satellites in view but not tracked. signal is the NMEA 4.10
+  signal ID (1 = L1, 7 = L5 for GPS...), 0 when the sentence has none.
+*/
+typedef struct {
+  uint8_t prn[LC29_GSV_MAX_SATELLITES];
+  uint8_t snr[LC29_GSV_MAX_SATELLITES]; // dB-Hz
+  uint8_t constellation[LC29_GSV_MAX_SATELLITES];
+  uint8_t signal[LC29_GSV_MAX_SATELLITES];
+  int8_t elevation[LC29_GSV_MAX_SATELLITES]; // degree
+  uint16_t azimuth[LC29_GSV_MAX_SATELLITES]; // degree from true north
+  uint8_t count;
+  uint8_t overflow; // satellites dropped because the table was full
+  // Sequence assembly
+  uint16_t sequences_done[LC29_CONSTELLATION_COUNT]; // bit per signal ID
+  uint8_t sequence_constellation;
+  uint8_t sequence_signal;
+  uint8_t sequence_total;
+  uint8_t sequence_next; // 0 when no sequence is in progress
+} qc_lc29x_gsv_table_s;
+
+typedef struct {
+  uint8_t in_view;
+  uint8_t tracked; // snr > 0
+  uint8_t snr_max;
+  uint8_t snr_mean; // over the tracked ones
+} qc_lc29x_snr_stats_s;
+
+/*
+  $--GSA: DOP and satellites used in the fix. The module sends one GSA per
+  system each epoch; every decoded sentence ORs its satellites into used[] of
+  its system, so reset the struct at the start of an epoch.
+
+  used[constellation] has bit n set for satellite n of that system (see
+  lc29_nmea_satellite_bit()), the same numbering as
+  lc29_nmea_gsv_satellite_sets(), so used and tracked satellites intersect
+  with a single AND per system.
+*/
+typedef struct {
+  uint64_t used[LC29_CONSTELLATION_COUNT];
+  uint16_t pdop;
+  uint16_t hdop;
+  uint16_t vdop;
+  uint8_t fix_type;    // 1 = no fix, 2 = 2D, 3 = 3D
+  char selection_mode; // 'A' automatic, 'M' manual
+  uint8_t system_id;   // NMEA 4.10 system ID of the last sentence, 0 if none
+} qc_lc29x_gsa_s;
+
+void lc29_nmea_date_cache_init(qc_lc29x_date_cache_s *cache);
+
+/* cache may be NULL, the date is then converted every time */
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_rmc(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_dec_accuracy_t precision,
+                     qc_lc29x_date_cache_s *cache, qc_lc29x_rmc_s *rmc);
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_vtg(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_vtg_s *vtg);
+
+/*
+  Adds the satellites of one GSV sentence to the table. The first sentence of
+  a sequence already in the table starts a new epoch, so feeding every GSV
+  the module sends keeps the table current without resetting it; call
+  lc29_nmea_gsv_table_reset() to start an epoch explicitly. A sentence out
+  of sequence drops the part of its sequence already added.
+*/
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_gsv(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_gsv_table_s *table);
+void lc29_nmea_gsv_table_reset(qc_lc29x_gsv_table_s *table);
+bool lc29_nmea_gsv_complete(const qc_lc29x_gsv_table_s *table);
+void lc29_nmea_gsv_snr_stats(
+    const qc_lc29x_gsv_table_s *table,
+    qc_lc29x_snr_stats_s stats[LC29_CONSTELLATION_COUNT]);
+
+void lc29_nmea_gsv_satellite_sets(const qc_lc29x_gsv_table_s *table,
+                                  uint8_t min_snr,
+                                  uint64_t sets[LC29_CONSTELLATION_COUNT]);
+
+void lc29_nmea_gsa_reset(qc_lc29x_gsa_s *gsa);
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_gsa(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_gsa_s *gsa);
+
+uint8_t lc29_nmea_satellite_bit(uint8_t constellation, uint8_t prn);
+
+/*
+  $PQTMINS: DR navigation result. solution_type is sent as is (0 while the
+  DR solution is pending); position, velocity and attitude are left empty
+  until the solution is available, has_* tells which were present.
+  Velocity is north, east, down.
+*/
+typedef struct {
+  uint32_t timestamp_ms; // module time since power on
+  int32_t latitude;
+  int32_t longitude;
+  int32_t height_mm;
+  int32_t velocity_mm_s[3];
+  int32_t roll_mdeg;
+  int32_t pitch_mdeg;
+  int32_t heading_mdeg;
+  uint8_t solution_type;
+  bool has_position;
+  bool has_velocity;
+  bool has_attitude;
+} qc_lc29x_pqtm_ins_s;
+
+/*
+  $PQTMIMU: raw IMU sample, axes x, y, z of the module frame. The wheel tick
+  fields are only sent by modules fed with wheel ticks.
+*/
+typedef struct {
+  uint32_t timestamp_ms;
+  int32_t acceleration_ug[3];
+  int32_t angular_rate_udps[3];
+  uint32_t wheel_ticks;
+  uint32_t wheel_tick_timestamp_ms;
+  bool has_wheel_ticks;
+} qc_lc29x_pqtm_imu_s;
+
+/* $PQTMGPS: the GNSS solution the DR engine was fed with */
+typedef struct {
+  uint32_t timestamp_ms;
+  uint32_t time_of_week_ms; // GPS time of week
+  int32_t latitude;
+  int32_t longitude;
+  int32_t height_mm;
+  uint32_t speed_mm_s;
+  int32_t heading_mdeg;
+  uint32_t horizontal_accuracy_mm;
+  uint16_t hdop;
+  uint8_t solution_type;
+  uint8_t num_satellites;
+  bool has_position;
+} qc_lc29x_pqtm_gps_s;
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_ins(const qc_lc29x_sentence_view_s *sentence,
+                          qc_lc29x_pqtm_ins_s *ins);
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_imu(const qc_lc29x_sentence_view_s *sentence,
+                          qc_lc29x_pqtm_imu_s *imu);
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_gps(const qc_lc29x_sentence_view_s *sentence,
+                          qc_lc29x_pqtm_gps_s *gps);
+
+bool lc29_nmea_is_type(const qc_lc29x_sentence_view_s *sentence,
+                       const char *type);
+
+/* <CalState> of $PQTMDRCAL */
+typedef enum {
+  LC29_DR_NOT_CALIBRATED,
+  LC29_DR_LIGHTLY_CALIBRATED,
+  LC29_DR_FULLY_CALIBRATED
+} qc_lc29x_dr_calibration_state_t;
+
+/* <NavType> of $PQTMDRCAL and $PQTMDRPVA */
+typedef enum {
+  LC29_DR_NAV_NO_POSITION,
+  LC29_DR_NAV_GNSS_ONLY,
+  LC29_DR_NAV_DR_ONLY,
+  LC29_DR_NAV_COMBINATION
+} qc_lc29x_dr_nav_type_t;
+
+/*
+  The sentences below start with a message version. Only version 1 is
+  decoded, any other version is LC29_NMEA_INVALID_FIELD rather than a
+  decode of a layout the decoder does not know.
+*/
+
+/* $PQTMDRCAL: DR calibration state, sent at the fix rate */
+typedef struct {
+  uint8_t calibration_state; // qc_lc29x_dr_calibration_state_t
+  uint8_t nav_type;          // qc_lc29x_dr_nav_type_t
+} qc_lc29x_pqtm_drcal_s;
+
+/*
+  $PQTMDRPVA: position, velocity and attitude of the DR solution, sent at the
+  fix rate. Velocity is north, east, down; speed is the horizontal speed.
+*/
+typedef struct {
+  uint32_t timestamp_ms;
+  uint32_t utc_time_ms;
+  int32_t latitude;
+  int32_t longitude;
+  int32_t altitude_mm;
+  int32_t geoid_separation_mm;
+  int32_t velocity_mm_s[3];
+  uint32_t speed_mm_s;
+  int32_t roll_mdeg;
+  int32_t pitch_mdeg;
+  int32_t heading_mdeg;
+  uint8_t nav_type; // qc_lc29x_dr_nav_type_t
+  bool has_time;
+  bool has_position;
+  bool has_velocity;
+  bool has_attitude;
+} qc_lc29x_pqtm_drpva_s;
+
+/*
+  $PQTMVEHMOT: vehicle motion after calibration, the IMU sample rotated into
+  the vehicle frame (x forward, y right, z down) with the biases removed.
+*/
+typedef struct {
+  uint32_t timestamp_ms;
+  int32_t speed_mm_s; // along x, negative when reversing
+  int32_t acceleration_ug[3];
+  int32_t angular_rate_udps[3];
+} qc_lc29x_pqtm_vehmot_s;
+
+/*
+  $PQTMSENMSG: raw sensor input at a fixed 10 Hz. The vehicle speed is only
+  present when the host feeds it in.
+*/
+typedef struct {
+  uint32_t timestamp_ms;
+  int16_t imu_temperature_cdeg_c;
+  int32_t acceleration_ug[3];
+  int32_t angular_rate_udps[3];
+  uint32_t vehicle_speed_mm_s;
+  bool has_vehicle_speed;
+} qc_lc29x_pqtm_senmsg_s;
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_drcal(const qc_lc29x_sentence_view_s *sentence,
+                            qc_lc29x_pqtm_drcal_s *drcal);
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_drpva(const qc_lc29x_sentence_view_s *sentence,
+                            qc_lc29x_pqtm_drpva_s *drpva);
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_vehmot(const qc_lc29x_sentence_view_s *sentence,
+                             qc_lc29x_pqtm_vehmot_s *vehmot);
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_senmsg(const qc_lc29x_sentence_view_s *sentence,
+                             qc_lc29x_pqtm_senmsg_s *senmsg);
+
+#endif
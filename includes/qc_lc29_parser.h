@@ -0,0 +1,128 @@
+#ifndef QC_LC29_PARSER_H_INCLUDED
+#define QC_LC29_PARSER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Incremental NMEA/PAIR/PQTM sentence parser.
+
+  Bytes are fed one at a time (straight from an RX interrupt if needed). While
+  the sentence arrives the parser XORs the checksum, records where every field
+  starts and measures the sentence identifier, so once the '\n' lands the
+  sentence is fully validated without another pass over it.
+*/
+
+/* Longest sentence accepted, including the <CR><LF> ending */
+#define LC29_SENTENCE_MAX_LENGTH 128
+
+/* Identifier plus data fields, GSV is the widest sentence with 21 */
+#define LC29_SENTENCE_MAX_FIELDS 24
+
+typedef enum {
+  LC29_PARSER_IDLE,
+  LC29_PARSER_ID,
+  LC29_PARSER_BODY,
+  LC29_PARSER_CHECKSUM_HI,
+  LC29_PARSER_CHECKSUM_LO,
+  LC29_PARSER_LINE_END
+} qc_lc29x_parser_state_t;
+
+typedef enum {
+  LC29_PARSE_IN_PROGRESS,
+  LC29_PARSE_SENTENCE_OK,
+  LC29_PARSE_NO_CHECKSUM,
+  LC29_PARSE_INVALID_CHECKSUM,
+  LC29_PARSE_MALFORMED
+} qc_lc29x_parse_result_t;
+
+/*
+  Sentence classes used to route what the module sends:
+  - PAIR_ACK:       $PAIR001 acknowledgement of a PAIR command
+  - PAIR_RESPONSE:  any other $PAIR sentence, i.e. a query result
+  - PQTM_RESPONSE:  reply to a PQTM command ($PQTM...OK/ERROR, $PQTMCFG...,
+                    $PQTMEINSMSG)
+  - NMEA:           standard NMEA output ($GNGGA, $GPRMC, ...)
+  - PQTM:           PQTM output messages ($PQTMINS, $PQTMIMU, ...)
+*/
+typedef enum {
+  LC29_SENTENCE_PAIR_ACK,
+  LC29_SENTENCE_PAIR_RESPONSE,
+  LC29_SENTENCE_PQTM_RESPONSE,
+  LC29_SENTENCE_NMEA,
+  LC29_SENTENCE_PQTM,
+  LC29_SENTENCE_CLASS_COUNT
+} qc_lc29x_sentence_class_t;
+
+/*
+  Offsets are relative to the '$'. Field 0 is the identifier (without the '$'),
+  field n starts right after the n-th comma. The field area ends at the '*'.
+*/
+typedef struct {
+  uint8_t num_fields;
+  uint8_t fields[LC29_SENTENCE_MAX_FIELDS];
+  uint8_t id_length;
+  uint8_t id; // qc_lc29x_sentence_id_t, see lc29_sentence_id()
+  uint8_t checksum_offset; // offset of the '*'
+  uint8_t checksum;        // XOR of everything between '$' and '*'
+  uint8_t expected_checksum;
+} qc_lc29x_sentence_info_s;
+
+typedef struct {
+  qc_lc29x_parser_state_t state;
+  uint16_t length;
+  qc_lc29x_sentence_info_s info;
+} qc_lc29x_parser_s;
+
+void lc29_parser_init(qc_lc29x_parser_s *parser);
+qc_lc29x_parse_result_t lc29_parser_feed(qc_lc29x_parser_s *parser, char c);
+qc_lc29x_parse_result_t lc29_parser_finish(qc_lc29x_parser_s *parser);
+qc_lc29x_parse_result_t lc29_parser_parse(qc_lc29x_parser_s *parser,
+                                          const char *sentence, size_t length);
+
+bool lc29_sentence_id_equals(const char *sentence,
+                             const qc_lc29x_sentence_info_s *info,
+                             const char *header);
+qc_lc29x_sentence_class_t
+lc29_sentence_classify(const char *sentence,
+                       const qc_lc29x_sentence_info_s *info);
+uint8_t lc29_sentence_field_length(const qc_lc29x_sentence_info_s *info,
+                                   uint8_t index);
+
+/*
+  Field access on a parsed sentence, nothing is written into it. The field
+  index is recorded while the sentence is parsed; a field is only converted
+  when one of these is called for it, so a consumer pays for the fields it
+  reads and no more.
+
+  lc29_sentence_field() returns the start of the field (not terminated) or
+  NULL when the sentence has fewer fields. The typed accessors return false
+  and leave value alone when the field is missing, empty (except _char) or
+  not of the type:
+  - _int:     integer with an optional '-' that fits 32 bits
+  - _decimal: decimal with an optional '-' scaled by 10^scale, "12.3456"
+              with scale 3 gives 12345, decimals past scale are truncated;
+              at most 9 digits once scaled
+  - _hex:     up to 8 hex digits, either case
+  - _char:    single character field, '\0' when empty
+  _int and _decimal use the qc_lc29_fixed.h kernels the NMEA decoders use.
+*/
+const char *lc29_sentence_field(const char *sentence,
+                                const qc_lc29x_sentence_info_s *info,
+                                uint8_t index, uint8_t *length);
+bool lc29_sentence_field_int(const char *sentence,
+                             const qc_lc29x_sentence_info_s *info,
+                             uint8_t index, int32_t *value);
+bool lc29_sentence_field_decimal(const char *sentence,
+                                 const qc_lc29x_sentence_info_s *info,
+                                 uint8_t index, uint8_t scale,
+                                 int32_t *value);
+bool lc29_sentence_field_hex(const char *sentence,
+                             const qc_lc29x_sentence_info_s *info,
+                             uint8_t index, uint32_t *value);
+bool lc29_sentence_field_char(const char *sentence,
+                              const qc_lc29x_sentence_info_s *info,
+                              uint8_t index, char *value);
+
+#endif
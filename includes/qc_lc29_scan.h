@@ -0,0 +1,59 @@
+#ifndef QC_LC29_SCAN_H_INCLUDED
+#define QC_LC29_SCAN_H_INCLUDED
+
+#include "qc_lc29_parser.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Bulk sentence scanner for recorded LC29H output.
+
+  The framer handles a live UART a byte at a time; offline tools have whole
+  buffers of sentences instead. lc29_scan_sentences() locates every '$', '*'
+  and '\n' of a buffer 64 bytes at a time and XORs the checksum of every
+  sentence found a vector at a time, with SSE2 or AVX2 kernels when the CPU
+  has them and a portable word-at-a-time kernel otherwise. The kernel is
+  picked at run time on first use, which is safe from several threads.
+*/
+
+typedef enum {
+  LC29_SCAN_AUTO, // best kernel the CPU supports
+  LC29_SCAN_SCALAR,
+  LC29_SCAN_SSE2,
+  LC29_SCAN_AVX2
+} qc_lc29x_scan_kernel_t;
+
+/*
+  A `$ ... \n` frame of the scanned buffer. valid is set when the frame ends
+  in *<Checksum>[<CR>]<LF> and the checksum matches, the same rule the parser
+  applies. Frames longer than LC29_SENTENCE_MAX_LENGTH are skipped.
+*/
+typedef struct {
+  size_t start;     // offset of the '$'
+  uint16_t length;  // up to and including the '\n'
+  uint8_t checksum; // XOR of everything between '$' and '*' (or line end)
+  bool valid;
+} qc_lc29x_scan_entry_s;
+
+/*
+  Scans data for complete frames, at most max_entries of them. consumed is
+  where scanning stopped: the start of a trailing incomplete frame, the start
+  of the first complete frame not reported when entries ran out, or length.
+  Carry data[consumed..length) over to the next buffer of the log.
+*/
+size_t lc29_scan_sentences(const char *data, size_t length,
+                           qc_lc29x_scan_entry_s *entries, size_t max_entries,
+                           size_t *consumed);
+
+/* XOR of length bytes, with the selected kernel */
+uint8_t lc29_scan_checksum(const char *data, size_t length);
+
+/*
+  Forces a kernel, LC29_SCAN_AUTO goes back to run time selection. Returns
+  false (and keeps the current kernel) when the CPU or the build lacks it.
+*/
+bool lc29_scan_use_kernel(qc_lc29x_scan_kernel_t kernel);
+qc_lc29x_scan_kernel_t lc29_scan_kernel(void);
+
+#endif
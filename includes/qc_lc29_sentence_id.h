@@ -0,0 +1,128 @@
+#ifndef QC_LC29_SENTENCE_ID_H_INCLUDED
+#define QC_LC29_SENTENCE_ID_H_INCLUDED
+
+#include "qc_lc29_driver.h"
+#include "qc_lc29_parser.h"
+#include <stdint.h>
+
+/*
+  Sentence identifiers as a dense enum.
+
+  Every header of qc_lc29_driver.h is listed once below. The slot table is
+  filled from this list by the hash function on the first lookup, so
+  resolving the identifier of a received sentence is one multiply, one table
+  load and one compare of the identifier, however many sentence types exist.
+
+  The hash takes the last three identifier characters and the fifth one
+  xor'ed with the identifier length, multiplied by LC29_SENTENCE_ID_MULTIPLIER;
+  the top 8 bits are the slot. When a new header collides with an existing
+  one (test_lc29_sentence_id_hash fails for it) pick another odd multiplier.
+*/
+#define LC29_SENTENCE_ID_MULTIPLIER 0xba28a679u
+#define LC29_SENTENCE_ID_SLOTS 256
+
+/* Shortest and longest listed identifier, without the '$' */
+#define LC29_SENTENCE_ID_MIN_LENGTH 7
+#define LC29_SENTENCE_ID_MAX_LENGTH 19
+
+#define LC29_SENTENCE_IDS(X)                                                   \
+  X(LC29_ID_PAIR_ACK, PAIR_ACK)                                                \
+  X(LC29_ID_PAIR_GNSS_SUBSYS_POWER_ON, PAIR_GNSS_SUBSYS_POWER_ON)              \
+  X(LC29_ID_PAIR_GNSS_SUBSYS_POWER_OFF, PAIR_GNSS_SUBSYS_POWER_OFF)            \
+  X(LC29_ID_PAIR_GNSS_SUBSYS_HOT_START, PAIR_GNSS_SUBSYS_HOT_START)            \
+  X(LC29_ID_PAIR_GNSS_SUBSYS_WARM_START, PAIR_GNSS_SUBSYS_WARM_START)          \
+  X(LC29_ID_PAIR_GNSS_SUBSYS_COLD_START, PAIR_GNSS_SUBSYS_COLD_START)          \
+  X(LC29_ID_PAIR_GNSS_SUBSYS_FULL_COLD_START,                                  \
+    PAIR_GNSS_SUBSYS_FULL_COLD_START)                                          \
+  X(LC29_ID_PAIR_REQUEST_AIDING, PAIR_REQUEST_AIDING)                          \
+  X(LC29_ID_PAIR_COMMON_SET_FIX_RATE, PAIR_COMMON_SET_FIX_RATE)                \
+  X(LC29_ID_PAIR_COMMON_GET_FIX_RATE, PAIR_COMMON_GET_FIX_RATE)                \
+  X(LC29_ID_PAIR_COMMON_SET_MIN_SNR, PAIR_COMMON_SET_MIN_SNR)                  \
+  X(LC29_ID_PAIR_COMMON_GET_MIN_SNR, PAIR_COMMON_GET_MIN_SNR)                  \
+  X(LC29_ID_PAIR_COMMON_SET_NMEA_OUTPUT_RATE,                                  \
+    PAIR_COMMON_SET_NMEA_OUTPUT_RATE)                                          \
+  X(LC29_ID_PAIR_COMMON_GET_NMEA_OUTPUT_RATE,                                  \
+    PAIR_COMMON_GET_NMEA_OUTPUT_RATE)                                          \
+  X(LC29_ID_PAIR_COMMON_SET_GNSS_SEARCH_MODE,                                  \
+    PAIR_COMMON_SET_GNSS_SEARCH_MODE)                                          \
+  X(LC29_ID_PAIR_COMMON_GET_GNSS_SEARCH_MODE,                                  \
+    PAIR_COMMON_GET_GNSS_SEARCH_MODE)                                          \
+  X(LC29_ID_PAIR_COMMON_SET_STATIC_THRESHOLD,                                  \
+    PAIR_COMMON_SET_STATIC_THRESHOLD)                                          \
+  X(LC29_ID_PAIR_COMMON_GET_STATIC_THRESHOLD,                                  \
+    PAIR_COMMON_GET_STATIC_THRESHOLD)                                          \
+  X(LC29_ID_PAIR_COMMON_SET_ELEV_MASK, PAIR_COMMON_SET_ELEV_MASK)              \
+  X(LC29_ID_PAIR_COMMON_GET_ELEV_MASK, PAIR_COMMON_GET_ELEV_MASK)              \
+  X(LC29_ID_PAIR_COMMON_SET_AIC_ENABLE, PAIR_COMMON_SET_AIC_ENABLE)            \
+  X(LC29_ID_PAIR_COMMON_SET_NAVIGATION_MODE, PAIR_COMMON_SET_NAVIGATION_MODE)  \
+  X(LC29_ID_PAIR_COMMON_GET_NAVIGATION_MODE, PAIR_COMMON_GET_NAVIGATION_MODE)  \
+  X(LC29_ID_PAIR_COMMON_SET_NMEA_POS_DECIMAL_PRECISION,                        \
+    PAIR_COMMON_SET_NMEA_POS_DECIMAL_PRECISION)                                \
+  X(LC29_ID_PAIR_COMMON_GET_NMEA_POS_DECIMAL_PRECISION,                        \
+    PAIR_COMMON_GET_NMEA_POS_DECIMAL_PRECISION)                                \
+  X(LC29_ID_PAIR_COMMON_SET_NMEA_OUTPUT_MODE,                                  \
+    PAIR_COMMON_SET_NMEA_OUTPUT_MODE)                                          \
+  X(LC29_ID_PAIR_COMMON_GET_NMEA_OUTPUT_MODE,                                  \
+    PAIR_COMMON_GET_NMEA_OUTPUT_MODE)                                          \
+  X(LC29_ID_PAIR_COMMON_SET_DUAL_BAND, PAIR_COMMON_SET_DUAL_BAND)              \
+  X(LC29_ID_PAIR_COMMON_GET_DUAL_BAND, PAIR_COMMON_GET_DUAL_BAND)              \
+  X(LC29_ID_PAIR_TEST_JAMMING_DETECT, PAIR_TEST_JAMMING_DETECT)                \
+  X(LC29_ID_PAIR_DGPS_SET_MODE, PAIR_DGPS_SET_MODE)                            \
+  X(LC29_ID_PAIR_DGPS_GET_MODE, PAIR_DGPS_GET_MODE)                            \
+  X(LC29_ID_PAIR_SBAS_ENABLE, PAIR_SBAS_ENABLE)                                \
+  X(LC29_ID_PAIR_SBAS_GET_STATUS, PAIR_SBAS_GET_STATUS)                        \
+  X(LC29_ID_PAIR_EASY_ENABLE, PAIR_EASY_ENABLE)                                \
+  X(LC29_ID_PAIR_EASY_GET_STATUS, PAIR_EASY_GET_STATUS)                        \
+  X(LC29_ID_PAIR_NVM_SAVE_SETTING, PAIR_NVM_SAVE_SETTING)                      \
+  X(LC29_ID_PAIR_LOW_POWER_ENTER_RTC_MODE, PAIR_LOW_POWER_ENTER_RTC_MODE)      \
+  X(LC29_ID_PAIR_PERIODIC_SET_MODE, PAIR_PERIODIC_SET_MODE)                    \
+  X(LC29_ID_PAIR_PERIODIC_GET_MODE, PAIR_PERIODIC_GET_MODE)                    \
+  X(LC29_ID_PAIR_PPS_SET_CONFIG_CMD, PAIR_PPS_SET_CONFIG_CMD)                  \
+  X(LC29_ID_PAIR_IO_SET_BAUDRATE, PAIR_IO_SET_BAUDRATE)                        \
+  X(LC29_ID_PAIR_IO_GET_BAUDRATE, PAIR_IO_GET_BAUDRATE)                        \
+  X(LC29_ID_DR_CALIBRATION, LC29_DR_CALIBRATION_HEADER)                        \
+  X(LC29_ID_DR_IMU_TYPE, LC29_DR_IMU_TYPE_HEADER)                              \
+  X(LC29_ID_DR_VEHICLE_INFO, LC29_DR_VEHICLE_INFO_HEADER)                      \
+  X(LC29_ID_DR_SAVE_SETTINGS, LC29_DR_SAVE_SETTINGS_HEADER)                    \
+  X(LC29_ID_DR_RESTORE_SETTINGS, LC29_DR_RESTORE_SETTINGS_HEADER)              \
+  X(LC29_ID_DR_NAV_RESULTS, LC29_DR_NAV_RESULTS_HEADER)                        \
+  X(LC29_ID_DR_IMU_DATA, LC29_DR_IMU_DATA_HEADER)                              \
+  X(LC29_ID_DR_GNSS_DATA, LC29_DR_GNSS_DATA_HEADER)                            \
+  X(LC29_ID_DR_PQTM_MESSAGE_CONFIG, LC29_DR_PQTM_MESSAGE_CONFIG_HEADER)        \
+  X(LC29_ID_DR_PQTM_MESSAGE_CONFIG_RESPONSE,                                   \
+    LC29_DR_PQTM_MESSAGE_CONFIG_RESPONSE_HEADER)                               \
+  X(LC29_ID_DR_MOTION_OUTPUT_AFTER_CALIBRATION,                                \
+    LC29_DR_MOTION_OUTPUT_AFTER_CALIBRATION_HEADER)                            \
+  X(LC29_ID_DR_SENSOR_OUTPUT, LC29_DR_SENSOR_OUTPUT_HEADER)                    \
+  X(LC29_ID_DR_RUNNING_TIME_COUNT, LC29_DR_RUNNING_TIME_COUNT_HEADER)          \
+  X(LC29_ID_DR_IMU_TEMP_COMPENSATION, LC29_DR_IMU_TEMP_COMPENSATION_HEADER)    \
+  X(LC29_ID_DR_POSITION_VELOCITY_ALTITUDE,                                     \
+    LC29_DR_POSITION_VELOCITY_ALTITUDE_HEADER)                                 \
+  X(LC29_ID_DR_HOT_START, LC29_DR_HOT_START_HEADER)                            \
+  X(LC29_ID_DR_STATE, LC29_DR_STATE_HEADER)                                    \
+  X(LC29_ID_DR_RESPONSE_OK, LC29_DR_RESPONSE_OK)                               \
+  X(LC29_ID_DR_RESPONSE_ERROR, LC29_DR_RESPONSE_ERROR)                         \
+  X(LC29_ID_PAIR_SET_CUSTOM_MSG_OUTPUT, PAIR_SET_CUSTOM_MSG_OUTPUT)            \
+  X(LC29_ID_PAIR_GET_CUSTOM_MSG_OUTPUT, PAIR_GET_CUSTOM_MSG_OUTPUT)
+
+typedef enum {
+  LC29_ID_UNKNOWN,
+#define LC29_SENTENCE_ID_ENUM(id, header) id,
+  LC29_SENTENCE_IDS(LC29_SENTENCE_ID_ENUM)
+#undef LC29_SENTENCE_ID_ENUM
+  LC29_ID_COUNT
+} qc_lc29x_sentence_id_t;
+
+/*
+  Identifier of a parsed sentence, LC29_ID_UNKNOWN for anything not listed
+  (standard NMEA output among others). The framer and lc29_parser_parse()
+  already store it in qc_lc29x_sentence_info_s.id.
+*/
+qc_lc29x_sentence_id_t lc29_sentence_id(const char *sentence,
+                                        const qc_lc29x_sentence_info_s *info);
+/* Identifier of a header string such as PAIR_ACK ("$PAIR001") */
+qc_lc29x_sentence_id_t lc29_sentence_id_lookup(const char *header);
+/* Header of an identifier, "" for LC29_ID_UNKNOWN */
+const char *lc29_sentence_id_header(qc_lc29x_sentence_id_t id);
+
+#endif
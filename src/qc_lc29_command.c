@@ -0,0 +1,151 @@
+/*
+  Quectel GNSS LC29X Command Serializer
+
+  The checksum covers every char between '$' and '*', so it is accumulated in
+  the same loop that copies them. Integers are written into a small scratch
+  buffer from the last digit backwards and copied over from there, which is
+  the only second touch of any byte.
+
+  Constant commands are spelled out below with the checksum worked out ahead
+  of time, test_lc29_constant_frames recomputes every one of them.
+*/
+
+#include "qc_lc29_command.h"
+#include "qc_lc29_driver.h"
+
+#define LC29_FRAME(header, checksum, cmd_id)                                   \
+  { header checksum LC29_CMD_END_CHARS,                                        \
+    sizeof(header checksum LC29_CMD_END_CHARS) - 1, cmd_id }
+
+const qc_lc29x_frame_s lc29_command_frames[LC29_FRAME_COUNT] = {
+    [LC29_FRAME_GNSS_POWER_ON] =
+        LC29_FRAME(PAIR_GNSS_SUBSYS_POWER_ON, "*38", 2),
+    [LC29_FRAME_GNSS_POWER_OFF] =
+        LC29_FRAME(PAIR_GNSS_SUBSYS_POWER_OFF, "*39", 3),
+    [LC29_FRAME_HOT_START] = LC29_FRAME(PAIR_GNSS_SUBSYS_HOT_START, "*3E", 4),
+    [LC29_FRAME_WARM_START] = LC29_FRAME(PAIR_GNSS_SUBSYS_WARM_START, "*3F", 5),
+    [LC29_FRAME_COLD_START] = LC29_FRAME(PAIR_GNSS_SUBSYS_COLD_START, "*3C", 6),
+    [LC29_FRAME_FULL_COLD_START] =
+        LC29_FRAME(PAIR_GNSS_SUBSYS_FULL_COLD_START, "*3D", 7),
+    [LC29_FRAME_NVM_SAVE_SETTING] =
+        LC29_FRAME(PAIR_NVM_SAVE_SETTING, "*3D", 513),
+    [LC29_FRAME_GET_FIX_RATE] = LC29_FRAME(PAIR_COMMON_GET_FIX_RATE, "*3E", 51),
+    [LC29_FRAME_GET_MIN_SNR] = LC29_FRAME(PAIR_COMMON_GET_MIN_SNR, "*36", 59),
+    [LC29_FRAME_GET_GNSS_SEARCH_MODE] =
+        LC29_FRAME(PAIR_COMMON_GET_GNSS_SEARCH_MODE, "*3B", 67),
+    [LC29_FRAME_GET_STATIC_THRESHOLD] =
+        LC29_FRAME(PAIR_COMMON_GET_STATIC_THRESHOLD, "*3C", 71),
+    [LC29_FRAME_GET_NAVIGATION_MODE] =
+        LC29_FRAME(PAIR_COMMON_GET_NAVIGATION_MODE, "*33", 81),
+    [LC29_FRAME_GET_NMEA_POS_DECIMAL_PRECISION] =
+        LC29_FRAME(PAIR_COMMON_GET_NMEA_POS_DECIMAL_PRECISION, "*3A", 99),
+    [LC29_FRAME_GET_NMEA_OUTPUT_MODE] =
+        LC29_FRAME(PAIR_COMMON_GET_NMEA_OUTPUT_MODE, "*3A", 101),
+    [LC29_FRAME_GET_DUAL_BAND] =
+        LC29_FRAME(PAIR_COMMON_GET_DUAL_BAND, "*3E", 105),
+    [LC29_FRAME_GET_SBAS_STATUS] = LC29_FRAME(PAIR_SBAS_GET_STATUS, "*3E", 411),
+    [LC29_FRAME_GET_EASY_STATUS] = LC29_FRAME(PAIR_EASY_GET_STATUS, "*36", 491),
+    [LC29_FRAME_GET_UART0_BAUDRATE] =
+        LC29_FRAME(PAIR_IO_GET_BAUDRATE ",0,0", "*31", 865),
+    [LC29_FRAME_DR_SAVE_SETTINGS] =
+        LC29_FRAME(LC29_DR_SAVE_SETTINGS_HEADER, "*5A", -1),
+    [LC29_FRAME_DR_GET_PQTM_MESSAGE_CONFIG] =
+        LC29_FRAME(LC29_DR_PQTM_MESSAGE_CONFIG_HEADER ",0", "*0E", -1),
+};
+
+static const char lc29_command_hex[] = "0123456789ABCDEF";
+
+static inline void lc29_command_put(qc_lc29x_command_s *command, char c) {
+  // Room is kept for the '\0' lc29_command_end() writes
+  if (command->length + 1 >= command->size) {
+    command->failed = true;
+    return;
+  }
+  command->buffer[command->length++] = c;
+  command->checksum ^= (uint8_t)c;
+}
+
+static void lc29_command_field(qc_lc29x_command_s *command, const char *field,
+                               size_t length) {
+  if (command->failed) {
+    return;
+  }
+  lc29_command_put(command, ',');
+  for (size_t i = 0; i < length && !command->failed; i++) {
+    lc29_command_put(command, field[i]);
+  }
+}
+
+void lc29_command_begin(qc_lc29x_command_s *command, char *buffer, size_t size,
+                        const char *header) {
+  command->buffer = buffer;
+  command->size = size;
+  command->length = 0;
+  command->checksum = 0;
+  command->failed = NULL == buffer || 0 == size || '$' != header[0];
+
+  if (!command->failed) {
+    // '$' is outside the checksum
+    buffer[command->length++] = '$';
+    for (const char *c = &header[1]; '\0' != *c && !command->failed; c++) {
+      lc29_command_put(command, *c);
+    }
+  }
+}
+
+void lc29_command_arg(qc_lc29x_command_s *command, const char *arg) {
+  if (command->failed) {
+    return;
+  }
+  lc29_command_put(command, ',');
+  for (const char *c = arg; '\0' != *c && !command->failed; c++) {
+    if (',' == *c || '*' == *c || '$' == *c || '\r' == *c || '\n' == *c) {
+      command->failed = true;
+      return;
+    }
+    lc29_command_put(command, *c);
+  }
+}
+
+void lc29_command_arg_uint(qc_lc29x_command_s *command, uint32_t value) {
+  char digits[10];
+  size_t count = sizeof(digits);
+
+  do {
+    digits[--count] = (char)('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  lc29_command_field(command, &digits[count], sizeof(digits) - count);
+}
+
+void lc29_command_arg_int(qc_lc29x_command_s *command, int32_t value) {
+  char digits[11];
+  size_t count = sizeof(digits);
+  uint32_t magnitude = value < 0 ? 0 - (uint32_t)value : (uint32_t)value;
+
+  do {
+    digits[--count] = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude > 0);
+  if (value < 0) {
+    digits[--count] = '-';
+  }
+  lc29_command_field(command, &digits[count], sizeof(digits) - count);
+}
+
+size_t lc29_command_end(qc_lc29x_command_s *command) {
+  // '*', two hex digits, <CR><LF> and the '\0'
+  if (command->failed || command->length + 6 > command->size) {
+    return 0;
+  }
+
+  char *end = &command->buffer[command->length];
+  end[0] = '*';
+  end[1] = lc29_command_hex[command->checksum >> 4];
+  end[2] = lc29_command_hex[command->checksum & 0x0F];
+  end[3] = '\r';
+  end[4] = '\n';
+  end[5] = '\0';
+  command->length += 5;
+  return command->length;
+}
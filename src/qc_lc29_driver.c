@@ -3,7 +3,6 @@
   Written by: @Cykibb
 
   TODO List:
-  - Clean-up getter and setter methods to support transmit_cmd() method
   - Add support for dead-reckoning commands
 
 ---
@@ -40,12 +39,61 @@ injected upon module power-up.
 */
 
 #include "qc_lc29_driver_internal.h"
+#include "qc_lc29_fixed.h"
+#include "qc_lc29_sentence_id.h"
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/*
+  Adapter presenting the legacy callbacks as a transport. The legacy read does
+  not report a byte count and is expected to null terminate what it read, and
+  neither callback knows about timeouts.
+*/
+static qc_lc29x_driver_response_t lc29_driver_legacy_init(void *ctx) {
+  qc_lc29_driver_s *driver = ctx;
+  return driver->lc29_driver_hw_init();
+}
+
+static int lc29_driver_legacy_write(void *ctx, const char *data, size_t length,
+                                    int timeout_ms) {
+  qc_lc29_driver_s *driver = ctx;
+  (void)timeout_ms;
+
+  if (driver->lc29_driver_write((char *)data, (int)length) != DRIVER_SUCCESS) {
+    return -1;
+  }
+  return (int)length;
+}
+
+static int lc29_driver_legacy_read(void *ctx, char *data, size_t length,
+                                   int timeout_ms) {
+  qc_lc29_driver_s *driver = ctx;
+  (void)timeout_ms;
+
+  data[0] = '\0';
+  if (driver->lc29_driver_read(data, (int)length - 1) != DRIVER_SUCCESS) {
+    return -1;
+  }
+  data[length - 1] = '\0';
+  return (int)strlen(data);
+}
+
+static qc_lc29x_driver_response_t lc29_driver_legacy_config(void *ctx,
+                                                            char config) {
+  qc_lc29_driver_s *driver = ctx;
+  return driver->lc29_driver_config(config);
+}
+
+static const qc_lc29x_transport_s lc29_driver_legacy_transport = {
+    .init = lc29_driver_legacy_init,
+    .write = lc29_driver_legacy_write,
+    .read = lc29_driver_legacy_read,
+    .config = lc29_driver_legacy_config,
+};
+
 // Quectel LC29 Driver Class Constructor
 qc_lc29_driver_s *Lc29_driver_ctor(
     qc_lc29x_driver_response_t (*lc29_driver_hw_init)(void),
@@ -63,16 +111,144 @@ qc_lc29_driver_s *Lc29_driver_ctor(
 }
 
 /*
- lc29_driver_init() reflects the default parameters that are laid out within the
- Quectel_LC29H&LC79H_GNSS_Protocol_Specification_v1.pdf to view default settings
- for LC29H modules...
+  Constructor taking a transport. The transport is copied, ctx is handed to
+  every transport callback and must outlive the driver.
 */
-qc_lc29_driver_s *lc29_driver_init(
-    qc_lc29_driver_s *driver,
-    qc_lc29x_driver_response_t (*lc29_driver_hw_init)(void),
-    qc_lc29x_driver_response_t (*lc29_driver_write)(char *data, int length),
-    qc_lc29x_driver_response_t (*lc29_driver_read)(char *data, int length),
-    qc_lc29x_driver_response_t (*lc29_driver_config)(char config)) {
+qc_lc29_driver_s *
+Lc29_driver_ctor_transport(const qc_lc29x_transport_s *transport, void *ctx) {
+  if (NULL == transport || NULL == transport->read ||
+      NULL == transport->write) {
+    return NULL;
+  }
+
+  qc_lc29_driver_s *lc29_driver = malloc(sizeof(qc_lc29_driver_s));
+  if (NULL == lc29_driver) {
+    return NULL;
+  }
+
+  return lc29_driver_init_transport(lc29_driver, transport, ctx);
+}
+
+_Static_assert(sizeof(qc_lc29_driver_s) <= LC29_DRIVER_STORAGE_SIZE,
+               "LC29_DRIVER_STORAGE_SIZE is too small for qc_lc29_driver_s");
+
+size_t lc29_driver_size(void) { return sizeof(qc_lc29_driver_s); }
+
+size_t lc29_driver_alignment(void) { return _Alignof(qc_lc29_driver_s); }
+
+/*
+  Constructor placing the driver in caller provided storage of at least
+  lc29_driver_size() bytes aligned to lc29_driver_alignment(), typically a
+  qc_lc29x_driver_storage_t. Never touches the heap; once constructed, no
+  driver function allocates either.
+*/
+qc_lc29_driver_s *Lc29_driver_ctor_static(void *storage, size_t size,
+                                          const qc_lc29x_transport_s *transport,
+                                          void *ctx) {
+  if (NULL == storage || size < sizeof(qc_lc29_driver_s) ||
+      (uintptr_t)storage % _Alignof(qc_lc29_driver_s) != 0) {
+    return NULL;
+  }
+  if (NULL == transport || NULL == transport->read ||
+      NULL == transport->write) {
+    return NULL;
+  }
+
+  qc_lc29_driver_s *lc29_driver =
+      lc29_driver_init_transport(storage, transport, ctx);
+  lc29_driver->storage = LC29_STORAGE_STATIC;
+  return lc29_driver;
+}
+
+/*
+  Releases a driver from any of the constructors. Commands still in flight are
+  dropped without their callback. NULL and a pool instance that was already
+  released are ignored.
+*/
+void Lc29_driver_dtor(qc_lc29_driver_s *driver) {
+  if (NULL == driver) {
+    return;
+  }
+
+  switch (driver->storage) {
+  case LC29_STORAGE_HEAP:
+    free(driver);
+    break;
+  case LC29_STORAGE_POOL: {
+    qc_lc29x_driver_pool_s *pool = driver->pool;
+    driver->storage = LC29_STORAGE_POOL_FREE;
+    driver->pool_next = pool->free_list;
+    pool->free_list = driver;
+    pool->available++;
+    break;
+  }
+  case LC29_STORAGE_POOL_FREE:
+    break;
+  case LC29_STORAGE_STATIC:
+  default:
+    // Leave nothing behind that could be mistaken for a live command
+    for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS; i++) {
+      driver->pending_cmds[i].state = LC29_CMD_FREE;
+    }
+    break;
+  }
+}
+
+/*
+  Sets up a pool over count storage slots. Returns the capacity.
+*/
+size_t lc29_driver_pool_init(qc_lc29x_driver_pool_s *pool,
+                             qc_lc29x_driver_storage_t *slots, size_t count) {
+  pool->free_list = NULL;
+  pool->capacity = 0;
+  pool->available = 0;
+  if (NULL == slots) {
+    return 0;
+  }
+
+  // Chain back to front so instances are handed out in slot order
+  for (size_t i = count; i > 0; i--) {
+    qc_lc29_driver_s *slot = (qc_lc29_driver_s *)&slots[i - 1];
+    slot->storage = LC29_STORAGE_POOL_FREE;
+    slot->pool = pool;
+    slot->pool_next = pool->free_list;
+    pool->free_list = slot;
+  }
+  pool->capacity = count;
+  pool->available = count;
+  return count;
+}
+
+/*
+  Takes an instance from the pool, NULL when all of them are in use.
+  Lc29_driver_dtor() hands it back.
+*/
+qc_lc29_driver_s *Lc29_driver_pool_ctor(qc_lc29x_driver_pool_s *pool,
+                                        const qc_lc29x_transport_s *transport,
+                                        void *ctx) {
+  if (NULL == pool || NULL == pool->free_list || NULL == transport ||
+      NULL == transport->read || NULL == transport->write) {
+    return NULL;
+  }
+
+  qc_lc29_driver_s *lc29_driver = pool->free_list;
+  pool->free_list = lc29_driver->pool_next;
+  pool->available--;
+
+  lc29_driver_init_transport(lc29_driver, transport, ctx);
+  lc29_driver->storage = LC29_STORAGE_POOL;
+  lc29_driver->pool = pool;
+  return lc29_driver;
+}
+
+/*
+ lc29_driver_init_transport() reflects the default parameters that are laid out
+ within the Quectel_LC29H&LC79H_GNSS_Protocol_Specification_v1.pdf to view
+ default settings for LC29H modules...
+*/
+qc_lc29_driver_s *
+lc29_driver_init_transport(qc_lc29_driver_s *driver,
+                           const qc_lc29x_transport_s *transport, void *ctx) {
   // Set Default Parameters for LC29 Module
   driver->fix_rate = ONE_HZ;
   driver->min_snr = 9;
@@ -107,7 +283,7 @@ qc_lc29_driver_s *lc29_driver_init(
   driver->low_pwr_rtc_clk = 0;
   driver->sleep_mode = DISABLE_PERIODIC_MODE; // Disable is default setting
   driver->pps_pin_setting = FIX_ONLY_3D;
-  driver->baud_rate = (uint16_t)LC29_BAUD_RATE_115200;
+  driver->baud_rate = LC29_BAUD_RATE_115200;
   driver->dr_rtk_output_rate = (qc_lc29x_pqtm_output_rate_settings_t){
       .ins = {PQTM_INS, false, 1},
       .imu = {PQTM_IMU, false, 1},
@@ -121,6 +297,36 @@ qc_lc29_driver_s *lc29_driver_init(
           .imu_type = {PQTMIMUTYPE, true},
           .dr_vehicle_motion = {PQTMVEHMOT, false},
       };
+  driver->lc29_driver_hw_init = NULL;
+  driver->lc29_driver_read = NULL;
+  driver->lc29_driver_write = NULL;
+  driver->lc29_driver_config = NULL;
+  driver->transport = *transport;
+  driver->transport_ctx = ctx;
+  lc29_framer_init(&driver->framer);
+  for (int i = 0; i < LC29_SENTENCE_CLASS_COUNT; i++) {
+    driver->handlers[i] = (qc_lc29x_sentence_handler_s){NULL, NULL};
+  }
+  for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS; i++) {
+    driver->pending_cmds[i].state = LC29_CMD_FREE;
+  }
+  driver->next_sequence = 0;
+  driver->lc29_driver_clock_ms = NULL;
+  driver->storage = LC29_STORAGE_HEAP;
+  driver->pool = NULL;
+  driver->pool_next = NULL;
+
+  return driver;
+}
+
+// Same as lc29_driver_init_transport() for the legacy callbacks
+qc_lc29_driver_s *lc29_driver_init(
+    qc_lc29_driver_s *driver,
+    qc_lc29x_driver_response_t (*lc29_driver_hw_init)(void),
+    qc_lc29x_driver_response_t (*lc29_driver_write)(char *data, int length),
+    qc_lc29x_driver_response_t (*lc29_driver_read)(char *data, int length),
+    qc_lc29x_driver_response_t (*lc29_driver_config)(char config)) {
+  lc29_driver_init_transport(driver, &lc29_driver_legacy_transport, driver);
   driver->lc29_driver_hw_init = lc29_driver_hw_init;
   driver->lc29_driver_read = lc29_driver_read;
   driver->lc29_driver_write = lc29_driver_write;
@@ -155,268 +361,1247 @@ The type of command/packet to be acknowledged.
 error
 5 = The MNL service is busy
 */
-// TODO: (@Kibby) Adjust method name to parse_cmd_response
-qc_lc29x_ack_reponse_t lc29_driver_parse_response(char *response_string,
+qc_lc29x_ack_reponse_t lc29_driver_parse_response(const char *response_string,
                                                   int command_id) {
+  qc_lc29x_ack_reponse_t result;
 
-  char *cmd_token;
-  char *cmd_response_token;
-  int response_cmd_id, response_cmd_status;
-  // validate incoming string
-  qc_lc29x_response_error_t validate_response = lc29_driver_validate_string(
-      PAIR_ACK, response_string, strlen(response_string), 1);
+  if (lc29_driver_parse_cmd_response(response_string, strlen(response_string),
+                                     command_id, &result) != VALID_RESPONSE) {
+    return CMD_SEND_FAIL;
+  }
+  return result;
+}
+
+/* lc29_driver_validate_string() that hands back the parsed field index */
+static qc_lc29x_response_error_t
+lc29_driver_validate_sentence(const char *pair_id, const char *sentence,
+                              size_t length, int check_checksum,
+                              qc_lc29x_parser_s *parser) {
+  /* should have atleast 9 characters */
+  if (9 > length) {
+    return LC_RESPONSE_INVALID_LENGTH;
+  }
+
+  /* should start with $ */
+  if ('$' != *sentence) {
+    return LC_RESPONSE_INVALID_START_CHAR;
+  }
+  /* single pass over the sentence, checksum and identifier come along */
+  qc_lc29x_parse_result_t result = lc29_parser_parse(parser, sentence, length);
+
+  /* should end with \r\n, or other... */
+  if (LC29_PARSE_IN_PROGRESS == result) {
+    return LC_RESPONSE_INVALID_R_N;
+  }
+
+  // Verify that the input string starts with '$PAIR001,' or general PAIR CMD ID
+  if (!lc29_sentence_id_equals(sentence, &parser->info, pair_id)) {
+    return LC_RESPONSE_INVALID_IDENTIFIER; // Invalid input string format
+  }
+
+  /* check for checksum */
+  if (LC29_PARSE_NO_CHECKSUM == result || LC29_PARSE_MALFORMED == result) {
+    return LC_RESPONSE_NO_CHECKSUM;
+  }
+
+  if (1 == check_checksum && LC29_PARSE_INVALID_CHECKSUM == result) {
+    return LC_RESPONSE_INVALID_CHECKSUM;
+  }
+  return VALID_RESPONSE;
+}
+
+/* $PAIR001,<Command_ID>,<Result> of an already validated sentence */
+static qc_lc29x_response_error_t
+lc29_driver_ack_fields(const char *sentence,
+                       const qc_lc29x_sentence_info_s *info, int command_id,
+                       qc_lc29x_ack_reponse_t *result) {
+  int32_t response_cmd_id, response_cmd_status;
+
+  if (LC29_ID_PAIR_ACK != info->id) {
+    return LC_RESPONSE_INVALID_IDENTIFIER;
+  }
+  if (info->num_fields != 3 ||
+      !lc29_sentence_field_int(sentence, info, 1, &response_cmd_id) ||
+      response_cmd_id != command_id ||
+      !lc29_sentence_field_int(sentence, info, 2, &response_cmd_status) ||
+      response_cmd_status < 0 || response_cmd_status > 5) {
+    return LC_RESPONSE_INVALID_FIELDS;
+  }
+
+  *result = (qc_lc29x_ack_reponse_t)response_cmd_status;
+  return VALID_RESPONSE;
+}
+
+/*
+  <command_id>,<Value>,...,<Value> of an already validated sentence, with
+  min_args to max_args values (info->num_fields - 1 of them).
+*/
+static qc_lc29x_response_error_t
+lc29_driver_query_fields(const char *sentence,
+                         const qc_lc29x_sentence_info_s *info,
+                         const char *command_id, int min_args, int max_args,
+                         int *parsed_query) {
+  int32_t values[LC29_SENTENCE_MAX_FIELDS];
+  int response_num_args = info->num_fields - 1;
+
+  if (!lc29_sentence_id_equals(sentence, info, command_id)) {
+    return LC_RESPONSE_INVALID_IDENTIFIER;
+  }
+  if (min_args < 0 || response_num_args < min_args ||
+      response_num_args > max_args) {
+    return LC_RESPONSE_INVALID_FIELDS;
+  }
+
+  // Nothing is handed out unless every value converts
+  for (int i = 0; i < response_num_args; i++) {
+    if (!lc29_sentence_field_int(sentence, info, (uint8_t)(i + 1),
+                                 &values[i])) {
+      return LC_RESPONSE_INVALID_FIELDS;
+    }
+  }
+  for (int i = 0; i < response_num_args; i++) {
+    parsed_query[i] = values[i];
+  }
+  return VALID_RESPONSE;
+}
+
+/*
+  Reentrant parsers for a single response held in a buffer. The sentence is
+  only read, length bytes of it (no terminator needed), and all parser state
+  lives on the stack, so several threads or driver instances can parse at
+  the same time, e.g. when recorded traffic is replayed in parallel.
+
+  Return VALID_RESPONSE and fill the out-parameter, or the reason the
+  sentence was refused; LC_RESPONSE_INVALID_FIELDS covers a mismatched
+  command ID, a wrong number of values and values that are not integers.
+*/
+qc_lc29x_response_error_t
+lc29_driver_parse_cmd_response(const char *response, size_t length,
+                               int command_id,
+                               qc_lc29x_ack_reponse_t *result) {
+  qc_lc29x_parser_s parser;
+  qc_lc29x_response_error_t error =
+      lc29_driver_validate_sentence(PAIR_ACK, response, length, 1, &parser);
+
+  if (error != VALID_RESPONSE) {
+    return error;
+  }
+  return lc29_driver_ack_fields(response, &parser.info, command_id, result);
+}
+
+qc_lc29x_response_error_t
+lc29_driver_parse_query_result(const char *response, size_t length,
+                               const char *command_id, int response_num_args,
+                               int *parsed_query) {
+  qc_lc29x_parser_s parser;
+  qc_lc29x_response_error_t error = lc29_driver_validate_sentence(
+      command_id, response, length, 1, &parser);
+
+  if (error != VALID_RESPONSE) {
+    return error;
+  }
+  return lc29_driver_query_fields(response, &parser.info, command_id,
+                                  response_num_args, response_num_args,
+                                  parsed_query);
+}
+
+/*
+  The LC29H gnss module will respond to a query request command with a result of
+  the query. The query can contain 1 or more attributes. An example of a
+
+  For example:
+  1. Packet Type: 051 PAIR_COMMON_GET_FIX_RATE
+  $PAIR051*3E       <-- QUERY REQUEST
+  $PAIR001,051,0*3F <-- CMD RESPONSE
+  $PAIR051,1000*13  <-- QUERY RESPONSE
+
+  2. Packet Type: 067 PAIR_COMMON_GET_GNSS_SEARCH_MODE
+  $PAIR067*3B              <-- QUERY REQUEST
+  $PAIR001,067,0*3A        <-- CMD RESPONSE
+  $PAIR067,1,0,0,0,0,0*3A  <-- QUERY RESPONSE
+*/
+qc_lc29x_ack_reponse_t
+lc29_driver_parse_query_response(const char *response_string,
+                                 const char *command_id,
+                                 int response_string_len,
+                                 int response_num_args, int *parsed_query) {
+  if (response_string_len < 0 ||
+      lc29_driver_parse_query_result(response_string,
+                                     (size_t)response_string_len, command_id,
+                                     response_num_args,
+                                     parsed_query) != VALID_RESPONSE) {
+    return CMD_SEND_FAIL;
+  }
+  return CMD_SEND_SUCCESS;
+}
+
+/*
+  Counterparts of lc29_driver_parse_response() and
+  lc29_driver_parse_query_response() for sentences handed out by the framer.
+  Those were validated while they were received and carry their field index,
+  so only the identifier is compared and the wanted fields converted.
+*/
+qc_lc29x_ack_reponse_t
+lc29_driver_parse_ack_sentence(const qc_lc29x_sentence_view_s *sentence,
+                               int command_id) {
+  qc_lc29x_ack_reponse_t result;
+
+  if (lc29_driver_ack_fields(sentence->data, sentence->info, command_id,
+                             &result) != VALID_RESPONSE) {
+    return CMD_SEND_FAIL;
+  }
+  return result;
+}
+
+qc_lc29x_ack_reponse_t
+lc29_driver_parse_query_sentence(const qc_lc29x_sentence_view_s *sentence,
+                                 const char *command_id, int response_num_args,
+                                 int *parsed_query) {
+  if (lc29_driver_query_fields(sentence->data, sentence->info, command_id,
+                               response_num_args, response_num_args,
+                               parsed_query) != VALID_RESPONSE) {
+    return CMD_SEND_FAIL;
+  }
+  return CMD_SEND_SUCCESS;
+}
+
+/*
+Acknowledges a PAIR command. An acknowledgement packet PAIR_ACK is returned to
+inform the sender that the receiver has received the packet.
+*/
+qc_lc29x_response_error_t lc29_driver_validate_string(const char *pair_id,
+                                                      const char *sentence,
+                                                      size_t length,
+                                                      int check_checksum) {
+  qc_lc29x_parser_s parser;
+  return lc29_driver_validate_sentence(pair_id, sentence, length,
+                                       check_checksum, &parser);
+}
+
+char *Lc29_driver_crop_sentence(char *sentence, size_t length) {
+  /* Skip type word, 7 characters (including $ and ,) */
+  sentence += 8;
+  /* Find the where the * is located and crop accordingly */
+  char *ret = strchr(sentence, (int)'*');
+  if (ret == NULL) {
+    *sentence = '\0';
+    return sentence;
+  } else {
+    *ret = '\0';
+  }
+  return sentence;
+}
+
+/*
+  Length of the sentence without its line ending. The module terminates every
+  sentence with <CR><LF>, but a sentence handed over by the framer stops at the
+  <LF> so any mix of trailing \r and \n is stripped.
+*/
+size_t lc29_driver_line_length(const char *sentence, size_t length) {
+  while (length > 0 &&
+         ('\r' == sentence[length - 1] || '\n' == sentence[length - 1])) {
+    length--;
+  }
+  return length;
+}
+
+uint8_t lc29_driver_response_has_checksum(const char *sentence, size_t length) {
+  length = lc29_driver_line_length(sentence, length);
+  if (length >= 3 && '*' == sentence[length - 3]) {
+    return 0;
+  }
+  return LC_RESPONSE_NO_CHECKSUM;
+}
+
+uint8_t lc29_driver_get_checksum(const char *sentence) {
+  const char *n = sentence + 1;
+  uint8_t chk = 0;
+
+  /* While current char isn't '*' or sentence ending (newline) */
+  while ('*' != *n && LC29_RESPONSE_END_CHAR != *n && '\0' != *n) {
+    chk ^= (uint8_t)*n;
+    n++;
+  }
+
+  return chk;
+}
+
+/*
+  Builds $<cmd_id>,<args[0]>,...*<Checksum><CR><LF> into cmd_result, which has
+  to hold LC29_CMD_MAX_LENGTH chars. Arguments are written in the order given
+  and must not contain the separators themselves.
+*/
+qc_lc29x_response_error_t lc29_driver_build_pair_cmd(uint8_t num_args,
+                                                     char *cmd_id, char *args[],
+                                                     char *cmd_result) {
+  qc_lc29x_command_s command;
+
+  lc29_command_begin(&command, cmd_result, LC29_CMD_MAX_LENGTH, cmd_id);
+  for (uint8_t i = 0; i < num_args; i++) {
+    lc29_command_arg(&command, args[i]);
+  }
+  return lc29_command_end(&command) > 0 ? VALID_RESPONSE
+                                        : LC_RESPONSE_INVALID_LENGTH;
+}
+
+/*
+  Registers the handler for one sentence class. Passing a NULL handler makes
+  the driver discard the sentences of that class again.
+*/
+qc_lc29x_driver_response_t
+lc29_driver_set_sentence_handler(qc_lc29_driver_s *driver,
+                                 qc_lc29x_sentence_class_t sentence_class,
+                                 qc_lc29x_sentence_handler_t handler,
+                                 void *context) {
+  if (sentence_class >= LC29_SENTENCE_CLASS_COUNT) {
+    return DRIVCER_FAIL;
+  }
+  driver->handlers[sentence_class].handler = handler;
+  driver->handlers[sentence_class].context = context;
+  return DRIVER_SUCCESS;
+}
+
+/*
+  Hands every queued sentence of a class to its handler, or drops them when no
+  handler is registered.
+*/
+void lc29_driver_dispatch(qc_lc29_driver_s *driver,
+                          qc_lc29x_sentence_class_t sentence_class) {
+  const qc_lc29x_sentence_handler_s *entry = &driver->handlers[sentence_class];
+  qc_lc29x_sentence_view_s sentence;
+
+  while (lc29_framer_next_class(&driver->framer, sentence_class, &sentence)) {
+    if (entry->handler != NULL) {
+      entry->handler(entry->context, &sentence);
+    }
+  }
+}
+
+static qc_lc29x_driver_response_t
+lc29_driver_receive(qc_lc29_driver_s *driver, int timeout_ms) {
+  char chunk[LC29_DRIVER_READ_CHUNK_SIZE];
+
+  int received = driver->transport.read(driver->transport_ctx, chunk,
+                                        sizeof(chunk), timeout_ms);
+  if (received < 0) {
+    return DRIVCER_FAIL;
+  }
+  lc29_framer_push(&driver->framer, chunk, (size_t)received);
+  return DRIVER_SUCCESS;
+}
+
+/*
+  Writes a whole command, the transport may accept it in several pieces.
+*/
+qc_lc29x_driver_response_t lc29_driver_write_all(qc_lc29_driver_s *driver,
+                                                 const char *data,
+                                                 size_t length) {
+  while (length > 0) {
+    int written = driver->transport.write(driver->transport_ctx, data, length,
+                                          LC29_DRIVER_IO_TIMEOUT_MS);
+    if (written <= 0) {
+      return DRIVCER_FAIL;
+    }
+    data += written;
+    length -= (size_t)written;
+  }
+  return DRIVER_SUCCESS;
+}
+
+static int lc29_driver_ack_command_id(const qc_lc29x_sentence_view_s *ack) {
+  int32_t cmd_id;
+  if (!lc29_sentence_field_int(ack->data, ack->info, 1, &cmd_id)) {
+    return -1;
+  }
+  return cmd_id;
+}
+
+/*
+  Oldest command in the given state with cmd_id, NULL when there is none. The
+  module answers the commands of one ID in the order they were written, so
+  several of them can be in flight and each answer goes to the oldest.
+*/
+static qc_lc29x_pending_cmd_s *
+lc29_driver_oldest_cmd(qc_lc29_driver_s *driver, int cmd_id,
+                       qc_lc29x_cmd_state_t state) {
+  qc_lc29x_pending_cmd_s *oldest = NULL;
+
+  for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS; i++) {
+    qc_lc29x_pending_cmd_s *cmd = &driver->pending_cmds[i];
+    // Signed difference keeps the order across a wrap of the sequence
+    if (cmd->state == state && cmd->cmd_id == cmd_id &&
+        (NULL == oldest || (int32_t)(cmd->sequence - oldest->sequence) < 0)) {
+      oldest = cmd;
+    }
+  }
+  return oldest;
+}
+
+static void lc29_driver_complete_cmd(qc_lc29x_pending_cmd_s *cmd,
+                                     qc_lc29x_ack_reponse_t result,
+                                     const int *query_values, int num_values) {
+  qc_lc29x_command_callback_t callback = cmd->callback;
+  void *context = cmd->context;
+  int cmd_id = cmd->cmd_id;
+
+  // Free the slot first so the callback can submit the next command
+  cmd->state = LC29_CMD_FREE;
+  if (callback != NULL) {
+    callback(context, cmd_id, result, query_values, num_values);
+  }
+}
+
+/*
+  Gives the driver a millisecond time source (any epoch, wrapping is fine).
+  With a clock every command in flight gets a deadline:
+  LC29_DRIVER_ACK_TIMEOUT_MS for its PAIR_ACK, extended by
+  LC29_DRIVER_PROCESSING_TIMEOUT_MS when the module answers with result 1.
+  The lc29_driver_submit_*() functions need the clock, so a command whose
+  answer is lost always gives its slot back; the blocking API works without
+  one and counts reads instead.
+*/
+qc_lc29x_driver_response_t
+lc29_driver_set_clock(qc_lc29_driver_s *driver, uint32_t (*clock_ms)(void)) {
+  driver->lc29_driver_clock_ms = clock_ms;
+  return DRIVER_SUCCESS;
+}
+
+static void lc29_driver_set_deadline(qc_lc29_driver_s *driver,
+                                     qc_lc29x_pending_cmd_s *cmd,
+                                     uint32_t timeout_ms) {
+  if (driver->lc29_driver_clock_ms != NULL) {
+    cmd->deadline_ms = driver->lc29_driver_clock_ms() + timeout_ms;
+  }
+}
+
+/*
+  Completes the commands whose deadline passed: CMD_SEND_FAIL when no PAIR_ACK
+  was received at all, COMAND_BEING_PROCESSED when the module was still busy
+  with it.
+*/
+static void lc29_driver_expire_cmds(qc_lc29_driver_s *driver) {
+  if (driver->lc29_driver_clock_ms == NULL) {
+    return;
+  }
+
+  uint32_t now = driver->lc29_driver_clock_ms();
+  for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS; i++) {
+    qc_lc29x_pending_cmd_s *cmd = &driver->pending_cmds[i];
+    // Signed difference keeps working across a wrap of the clock
+    if (cmd->state == LC29_CMD_FREE || (int32_t)(now - cmd->deadline_ms) < 0) {
+      continue;
+    }
+    lc29_driver_complete_cmd(cmd,
+                             cmd->processing ? COMAND_BEING_PROCESSED
+                                             : CMD_SEND_FAIL,
+                             NULL, 0);
+  }
+}
+
+static bool lc29_driver_handle_ack(qc_lc29_driver_s *driver,
+                                   const qc_lc29x_sentence_view_s *ack) {
+  int cmd_id = lc29_driver_ack_command_id(ack);
+  qc_lc29x_pending_cmd_s *cmd =
+      lc29_driver_oldest_cmd(driver, cmd_id, LC29_CMD_AWAIT_ACK);
+  if (cmd == NULL) {
+    return false;
+  }
+
+  qc_lc29x_ack_reponse_t result = lc29_driver_parse_ack_sentence(ack, cmd_id);
+  if (result == COMAND_BEING_PROCESSED) {
+    // Not done yet, the module sends a final PAIR_ACK once it is
+    if (!cmd->processing) {
+      cmd->processing = true;
+      lc29_driver_set_deadline(driver, cmd, LC29_DRIVER_PROCESSING_TIMEOUT_MS);
+    }
+    return true;
+  }
+  if (result == CMD_SEND_SUCCESS && cmd->query_id != NULL) {
+    cmd->state = LC29_CMD_AWAIT_RESULT;
+    return true;
+  }
+
+  lc29_driver_complete_cmd(cmd, result, NULL, 0);
+  return true;
+}
+
+static bool lc29_driver_handle_result(qc_lc29_driver_s *driver,
+                                      const qc_lc29x_sentence_view_s *result) {
+  int query_values[PAIR_QUERY_MAX_ARGS];
+  qc_lc29x_pending_cmd_s *oldest = NULL;
+
+  for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS; i++) {
+    qc_lc29x_pending_cmd_s *cmd = &driver->pending_cmds[i];
+    if (cmd->state != LC29_CMD_AWAIT_RESULT) {
+      continue;
+    }
+    // Query IDs outside the identifier list are still compared as strings
+    if (LC29_ID_UNKNOWN != cmd->query_sentence_id
+            ? cmd->query_sentence_id != result->info->id
+            : !lc29_sentence_id_equals(result->data, result->info,
+                                       cmd->query_id)) {
+      continue;
+    }
+    // Results come back in the order of the queries, as the ACKs do
+    if (NULL == oldest || (int32_t)(cmd->sequence - oldest->sequence) < 0) {
+      oldest = cmd;
+    }
+  }
+  if (NULL == oldest) {
+    return false;
+  }
+
+  if (lc29_driver_query_fields(result->data, result->info, oldest->query_id,
+                               oldest->query_min_args, oldest->query_num_args,
+                               query_values) != VALID_RESPONSE) {
+    lc29_driver_complete_cmd(oldest, CMD_SEND_FAIL, NULL, 0);
+  } else {
+    lc29_driver_complete_cmd(oldest, CMD_SEND_SUCCESS, query_values,
+                             result->info->num_fields - 1);
+  }
+  return true;
+}
+
+/*
+  Matches queued PAIR_ACKs and query results against the commands in flight.
+  Sentences no command is waiting for (left overs from a command that gave up)
+  go to the handler of their class, if any.
+*/
+void lc29_driver_process_responses(qc_lc29_driver_s *driver) {
+  const qc_lc29x_sentence_handler_s *entry;
+  qc_lc29x_sentence_view_s sentence;
+
+  entry = &driver->handlers[LC29_SENTENCE_PAIR_ACK];
+  while (lc29_framer_next_class(&driver->framer, LC29_SENTENCE_PAIR_ACK,
+                                &sentence)) {
+    if (!lc29_driver_handle_ack(driver, &sentence) && entry->handler != NULL) {
+      entry->handler(entry->context, &sentence);
+    }
+  }
+
+  entry = &driver->handlers[LC29_SENTENCE_PAIR_RESPONSE];
+  while (lc29_framer_next_class(&driver->framer, LC29_SENTENCE_PAIR_RESPONSE,
+                                &sentence)) {
+    if (!lc29_driver_handle_result(driver, &sentence) &&
+        entry->handler != NULL) {
+      entry->handler(entry->context, &sentence);
+    }
+  }
+
+  lc29_driver_dispatch(driver, LC29_SENTENCE_NMEA);
+  lc29_driver_dispatch(driver, LC29_SENTENCE_PQTM);
+  lc29_driver_expire_cmds(driver);
+}
+
+/*
+  Reads from the module once and dispatches everything received: commands in
+  flight are completed and the NMEA and PQTM output goes to its handlers.
+  Async users call this from their main loop; PQTM command replies that show
+  up here are not awaited by anyone and go to their handler (if any).
+*/
+qc_lc29x_driver_response_t lc29_driver_poll(qc_lc29_driver_s *driver) {
+  qc_lc29x_driver_response_t response = lc29_driver_receive(driver, 0);
+
+  lc29_driver_feed(driver, NULL, 0);
+  return response;
+}
+
+/*
+  Hands bytes received outside of the transport read callback (RX interrupt,
+  event loop) to the driver and dispatches them as in lc29_driver_poll().
+*/
+void lc29_driver_feed(qc_lc29_driver_s *driver, const char *data,
+                      size_t length) {
+  lc29_framer_push(&driver->framer, data, length);
+  lc29_driver_process_responses(driver);
+  lc29_driver_dispatch(driver, LC29_SENTENCE_PQTM_RESPONSE);
+}
+
+/*
+  Returns the next sentence of the given class received from the module.
+  Sentences that are already framed are handed out first, the read callback is
+  only called when nothing of that class is queued. A single read may carry
+  several sentences (or only part of one), the framer takes care of both cases.
+  Everything else received while waiting is processed as in lc29_driver_poll(),
+  so the position stream keeps flowing during a command round-trip.
+*/
+qc_lc29x_driver_response_t
+lc29_driver_read_sentence(qc_lc29_driver_s *driver,
+                          qc_lc29x_sentence_class_t sentence_class,
+                          qc_lc29x_sentence_view_s *sentence) {
+  for (int attempt = 0; attempt <= LC29_DRIVER_MAX_READ_ATTEMPTS; attempt++) {
+    lc29_driver_process_responses(driver);
+
+    if (lc29_framer_next_class(&driver->framer, sentence_class, sentence)) {
+      return DRIVER_SUCCESS;
+    }
+
+    if (attempt == LC29_DRIVER_MAX_READ_ATTEMPTS ||
+        lc29_driver_receive(driver, LC29_DRIVER_IO_TIMEOUT_MS) !=
+            DRIVER_SUCCESS) {
+      break;
+    }
+  }
+
+  return DRIVCER_FAIL;
+}
 
-  if (validate_response != VALID_RESPONSE) {
+/*
+  Writes a PAIR command and adds it to the pending table without waiting for
+  the module. The command completes through callback once its PAIR_ACK (and
+  for queries the result $<query_id>,...) has been received by
+  lc29_driver_poll(). Up to LC29_DRIVER_MAX_PENDING_CMDS commands can be in
+  flight, the same command ID several times (e.g. PAIR062 for every NMEA
+  sentence), so a whole configuration can be written back-to-back.
+  query_id must stay valid until the command completes.
+
+  Needs a clock (lc29_driver_set_clock()) to expire commands that are never
+  answered. Returns CMD_SEND_SUCCESS once the command is written, CMD_INVALID
+  without a clock and CMD_QUEUE_FULL when every slot is in flight.
+*/
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_query(qc_lc29_driver_s *driver, char *cmd_payload,
+                         int cmd_id, const char *query_id, int query_num_args,
+                         qc_lc29x_command_callback_t callback, void *context) {
+  if (NULL == driver->lc29_driver_clock_ms) {
+    return CMD_INVALID;
+  }
+  return lc29_driver_submit_frame(driver, cmd_payload, strlen(cmd_payload),
+                                  cmd_id, query_id, query_num_args, callback,
+                                  context, NULL);
+}
+
+/*
+  lc29_driver_submit_query() for a frame whose length is already known, also
+  used by the blocking API without a clock. slot (may be NULL) receives the
+  pending entry, valid until the command completes.
+*/
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_frame(qc_lc29_driver_s *driver, const char *frame,
+                         size_t length, int cmd_id, const char *query_id,
+                         int query_num_args,
+                         qc_lc29x_command_callback_t callback, void *context,
+                         qc_lc29x_pending_cmd_s **slot) {
+  qc_lc29x_pending_cmd_s *cmd = NULL;
+
+  if (query_num_args < 0 || query_num_args > PAIR_QUERY_MAX_ARGS) {
+    return CMD_INVALID;
+  }
+
+  for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS && cmd == NULL; i++) {
+    if (driver->pending_cmds[i].state == LC29_CMD_FREE) {
+      cmd = &driver->pending_cmds[i];
+    }
+  }
+  if (cmd == NULL) {
+    return CMD_QUEUE_FULL;
+  }
+
+  if (lc29_driver_write_all(driver, frame, length) != DRIVER_SUCCESS) {
     return CMD_SEND_FAIL;
   }
 
-  // Check for if the received command id and response command id are the same
-  // Extract the command ID
-  cmd_token = strtok(response_string + 9, ",");
-  if (cmd_token == NULL) {
-    return CMD_SEND_FAIL; // Invalid input string format
-  }
+  cmd->state = LC29_CMD_AWAIT_ACK;
+  cmd->cmd_id = cmd_id;
+  cmd->sequence = driver->next_sequence++;
+  cmd->query_id = query_id;
+  cmd->query_sentence_id =
+      NULL != query_id ? lc29_sentence_id_lookup(query_id) : LC29_ID_UNKNOWN;
+  cmd->query_num_args = query_num_args;
+  cmd->query_min_args = query_num_args;
+  cmd->processing = false;
+  lc29_driver_set_deadline(driver, cmd, LC29_DRIVER_ACK_TIMEOUT_MS);
+  cmd->callback = callback;
+  cmd->context = context;
+  if (slot != NULL) {
+    *slot = cmd;
+  }
+  return CMD_SEND_SUCCESS;
+}
+
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_cmd(qc_lc29_driver_s *driver, char *cmd_payload, int cmd_id,
+                       qc_lc29x_command_callback_t callback, void *context) {
+  return lc29_driver_submit_query(driver, cmd_payload, cmd_id, NULL, 0,
+                                  callback, context);
+}
+
+uint8_t lc29_driver_pending_cmds(const qc_lc29_driver_s *driver) {
+  uint8_t pending = 0;
+
+  for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS; i++) {
+    pending += driver->pending_cmds[i].state != LC29_CMD_FREE;
+  }
+  return pending;
+}
+
+/*
+  PAIR098 setting the module was last configured with (or reported through
+  lc29_driver_get_NMEA_decimal_precision()), for the NMEA decoders.
+*/
+qc_lc29x_dec_accuracy_t
+lc29_driver_decimal_accuracy(const qc_lc29_driver_s *driver) {
+  return driver->decimal_accuracy;
+}
+
+/*
+  Output configuration the driver last set or read back: the fix interval,
+  the NMEA output rate of every sentence (0 = off, n = every n-th fix) and
+  the PQTM DR output. Used to know which sentences make up an epoch.
+*/
+qc_lc29x_fix_rate_t lc29_driver_fix_interval(const qc_lc29_driver_s *driver) {
+  return driver->fix_rate;
+}
+
+const qc_lc29x_nmea_output_rate_s *
+lc29_driver_nmea_output_rates(const qc_lc29_driver_s *driver) {
+  return &driver->nmea_output_rate;
+}
+
+const qc_lc29x_pqtm_output_rate_settings_t *
+lc29_driver_dr_output_rates(const qc_lc29_driver_s *driver) {
+  return &driver->dr_rtk_output_rate;
+}
+
+typedef struct {
+  bool done;
+  qc_lc29x_ack_reponse_t result;
+  int *parsed_query;
+  int num_values;
+} qc_lc29x_cmd_waiter_s;
+
+static void lc29_driver_cmd_done(void *context, int cmd_id,
+                                 qc_lc29x_ack_reponse_t result,
+                                 const int *query_values, int num_values) {
+  qc_lc29x_cmd_waiter_s *waiter = context;
+  (void)cmd_id;
+
+  waiter->done = true;
+  waiter->result = result;
+  waiter->num_values = num_values;
+  if (waiter->parsed_query != NULL && query_values != NULL) {
+    memcpy(waiter->parsed_query, query_values,
+           (size_t)num_values * sizeof(*query_values));
+  }
+}
+
+/*
+  Blocking wrapper around the pipelined engine: submits the command and pumps
+  the read callback until it completes. Other commands in flight keep being
+  completed while waiting. With a clock the command deadlines bound the wait,
+  otherwise LC29_DRIVER_MAX_READ_ATTEMPTS reads are allowed for the PAIR_ACK
+  and as many again once the module reported it is processing the command.
+  A query result may carry query_min_args to query_num_args values, how many
+  it did is stored in num_values (if not NULL).
+*/
+static qc_lc29x_ack_reponse_t
+lc29_driver_submit_and_wait(qc_lc29_driver_s *driver, const char *frame,
+                            size_t length, int cmd_id, const char *query_id,
+                            int query_min_args, int query_num_args,
+                            int *parsed_query, int *num_values) {
+  qc_lc29x_cmd_waiter_s waiter = {false, CMD_SEND_FAIL, parsed_query, 0};
+  qc_lc29x_pending_cmd_s *cmd;
+  bool processing = false;
+
+  qc_lc29x_ack_reponse_t cmd_response = lc29_driver_submit_frame(
+      driver, frame, length, cmd_id, query_id, query_num_args,
+      lc29_driver_cmd_done, &waiter, &cmd);
+  if (cmd_response != CMD_SEND_SUCCESS) {
+    return cmd_response;
+  }
+  // Nothing is read before the loop below, the entry is still untouched
+  cmd->query_min_args = query_min_args;
+
+  for (int attempt = 0;; attempt++) {
+    lc29_driver_process_responses(driver);
+    if (waiter.done) {
+      if (num_values != NULL) {
+        *num_values = waiter.num_values;
+      }
+      return waiter.result;
+    }
 
-  response_cmd_id = atoi(cmd_token);
-  if (response_cmd_id != command_id) {
-    return CMD_SEND_FAIL;
-  }
+    if (cmd->processing && !processing) {
+      processing = true;
+      attempt = 0;
+    }
 
-  cmd_response_token = strtok(response_string + 14, ",");
-  if (cmd_response_token == NULL) {
-    return CMD_SEND_FAIL; // Invalid input string format
-  }
-  // TODO (@Kibby) - Make a more robust check and condition handling for other
-  // cases of command processing etc...
-  response_cmd_status = atoi(cmd_response_token);
-  if (response_cmd_status > 5) {
-    return CMD_SEND_FAIL;
+    if ((driver->lc29_driver_clock_ms == NULL &&
+         attempt == LC29_DRIVER_MAX_READ_ATTEMPTS) ||
+        lc29_driver_receive(driver, LC29_DRIVER_IO_TIMEOUT_MS) !=
+            DRIVER_SUCCESS) {
+      break;
+    }
   }
 
-  return response_cmd_status;
+  // Give up on the command, a late ACK is then treated as stale
+  cmd->state = LC29_CMD_FREE;
+  return processing ? COMAND_BEING_PROCESSED : CMD_SEND_FAIL;
 }
 
 /*
-  The LC29H gnss module will respond to a query request command with a result of
-  the query. The query can contain 1 or more attributes. An example of a
-
-  For example:
-  1. Packet Type: 051 PAIR_COMMON_GET_FIX_RATE
-  $PAIR051*3E       <-- QUERY REQUEST
-  $PAIR001,051,0*3F <-- CMD RESPONSE
-  $PAIR051,1000*13  <-- QUERY RESPONSE
-
-  2. Packet Type: 067 PAIR_COMMON_GET_GNSS_SEARCH_MODE
-  $PAIR067*3B              <-- QUERY REQUEST
-  $PAIR001,067,0*3A        <-- CMD RESPONSE
-  $PAIR067,1,0,0,0,0,0*3A  <-- QUERY RESPONSE
+  Command registry. Every PAIR command of the setters and getters, and the PQTM
+  commands that keep state, is described once below and sent by
+  lc29_driver_execute(); the public functions only collect its arguments.
 */
-qc_lc29x_ack_reponse_t lc29_driver_parse_query_response(char *response_string,
-                                                        char *command_id,
-                                                        int response_string_len,
-                                                        int response_num_args,
-                                                        int *parsed_query) {
 
-  // int query_response_args = 0;
+/* Frame of a command that is built from its header and arguments */
+#define LC29_NO_FRAME LC29_FRAME_COUNT
 
-  // Step 1: validate incoming string
-  qc_lc29x_response_error_t validate_response = lc29_driver_validate_string(
-      command_id, response_string, response_string_len, 1);
+#define LC29_PAIR(hdr, id, frm, n, q)                                          \
+  .header = (hdr), .cmd_id = (id), .frame = (frm), .num_args = (n),            \
+  .query_num_args = (q)
 
-  if (validate_response != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
+/*
+  PAIR491 answers <Enable>,<Status>: value 0 is easy_enable, value 1 the
+  progress of the EASY prediction, which is only sent while it is enabled.
+*/
+static void lc29_driver_keep_easy_status(qc_lc29_driver_s *driver,
+                                         const int *values, int num_values) {
+  driver->easy_enable = 0 != values[0];
+  if (num_values > 1) {
+    driver->easy_status = (qc_lc29x_easy_mode_status_t)values[1];
   }
+}
 
-  // Step 2: Parse the response values
-  if (lc29_driver_parse_string_by_comma(strlen(command_id) + 1, response_string,
-                                        parsed_query, response_num_args) !=
-      response_num_args) {
-    return CMD_SEND_FAIL;
+/*
+  <Type>,<INS_Enabled>,<IMU_Enabled>,<GPS_Enabled>,<Rate> of both the SET and
+  the query result of PQTMCFGEINSMSG. $PQTMGPS is not output faster than
+  10 Hz, whatever the rate.
+*/
+static void lc29_driver_keep_pqtm_output(qc_lc29_driver_s *driver,
+                                         const int *values, int num_values) {
+  qc_lc29x_pqtm_output_rate_settings_t *output = &driver->dr_rtk_output_rate;
+  (void)num_values;
+
+  output->ins.enabled = 0 != values[1];
+  output->ins.fix_rate = values[4];
+  output->imu.enabled = 0 != values[2];
+  output->imu.fix_rate = values[4];
+  output->gps.enabled = 0 != values[3];
+  output->gps.fix_rate = values[4] > 10 ? 10 : values[4];
+}
+
+/* Driver field that keeps count values from first on */
+#define LC29_KEEP(field, first, count, flags)                                  \
+  .state_offset = offsetof(qc_lc29_driver_s, field),                           \
+  .state_size = sizeof(((qc_lc29_driver_s *)0)->field),                        \
+  .state_first = (first), .state_count = (count), .state_flags = (flags)
+
+/* Same for an array of element_type, indexed by value 0 */
+#define LC29_KEEP_INDEXED(field, element_type, flags)                          \
+  LC29_KEEP(field, 1, 1, (flags) | LC29_STATE_INDEXED),                        \
+      .state_stride = sizeof(element_type)
+
+const qc_lc29x_pair_cmd_desc_s lc29_pair_cmds[LC29_PAIR_CMD_COUNT] = {
+    [LC29_PAIR_SET_FIX_RATE] = {LC29_PAIR(PAIR_COMMON_SET_FIX_RATE, 50,
+                                          LC29_NO_FRAME, 1, 0),
+                                .args = {LC29_ARG_FIX_INTERVAL},
+                                LC29_KEEP(fix_rate, 0, 1, 0)},
+    [LC29_PAIR_GET_FIX_RATE] = {LC29_PAIR(PAIR_COMMON_GET_FIX_RATE, 51,
+                                          LC29_FRAME_GET_FIX_RATE, 0,
+                                          PAIR_QUERY_FIX_RATE_NUM_ARGS),
+                                LC29_KEEP(fix_rate, 0, 1, 0)},
+    [LC29_PAIR_SET_MIN_SNR] = {LC29_PAIR(PAIR_COMMON_SET_MIN_SNR, 58,
+                                         LC29_NO_FRAME, 1, 0),
+                               .args = {LC29_ARG_MIN_SNR},
+                               LC29_KEEP(min_snr, 0, 1, 0)},
+    [LC29_PAIR_GET_MIN_SNR] = {LC29_PAIR(PAIR_COMMON_GET_MIN_SNR, 59,
+                                         LC29_FRAME_GET_MIN_SNR, 0,
+                                         PAIR_QUERY_MIN_SNR_NUM_ARGS),
+                               LC29_KEEP(min_snr, 0, 1, 0)},
+    [LC29_PAIR_SET_NMEA_OUTPUT_RATE] =
+        {LC29_PAIR(PAIR_COMMON_SET_NMEA_OUTPUT_RATE, 62, LC29_NO_FRAME, 2, 0),
+         .args = {LC29_ARG_NMEA_TYPE, LC29_ARG_NMEA_RATE},
+         LC29_KEEP_INDEXED(nmea_output_rate.gga.output_rate,
+                           qc_lc29x_nmea_output_rate_settings_s, 0)},
+    [LC29_PAIR_GET_NMEA_OUTPUT_RATE] =
+        {LC29_PAIR(PAIR_COMMON_GET_NMEA_OUTPUT_RATE, 63, LC29_NO_FRAME, 1,
+                   PAIR_QUERY_NMEA_RATE_NUM_ARGS),
+         .args = {LC29_ARG_NMEA_TYPE},
+         LC29_KEEP_INDEXED(nmea_output_rate.gga.output_rate,
+                           qc_lc29x_nmea_output_rate_settings_s, 0)},
+    [LC29_PAIR_SET_GNSS_SEARCH_MODE] =
+        {LC29_PAIR(PAIR_COMMON_SET_GNSS_SEARCH_MODE, 66, LC29_NO_FRAME, 6, 0),
+         .args = {LC29_ARG_BOOL, LC29_ARG_BOOL, LC29_ARG_BOOL, LC29_ARG_BOOL,
+                  LC29_ARG_BOOL, LC29_ARG_ZERO},
+         LC29_KEEP(gnss_search_mode.gps_enabled, 0, 6, LC29_STATE_BOOL)},
+    [LC29_PAIR_GET_GNSS_SEARCH_MODE] =
+        {LC29_PAIR(PAIR_COMMON_GET_GNSS_SEARCH_MODE, 67,
+                   LC29_FRAME_GET_GNSS_SEARCH_MODE, 0,
+                   PAIR_QUERY_GNSS_SEARCH_MODE_ARGS),
+         LC29_KEEP(gnss_search_mode.gps_enabled, 0, 6, LC29_STATE_BOOL)},
+    [LC29_PAIR_SET_STATIC_THRESHOLD] =
+        {LC29_PAIR(PAIR_COMMON_SET_STATIC_THRESHOLD, 70, LC29_NO_FRAME, 1, 0),
+         .args = {LC29_ARG_SPEED_THRESHOLD},
+         LC29_KEEP(static_spd_thrshld, 0, 1, 0)},
+    [LC29_PAIR_GET_STATIC_THRESHOLD] =
+        {LC29_PAIR(PAIR_COMMON_GET_STATIC_THRESHOLD, 71,
+                   LC29_FRAME_GET_STATIC_THRESHOLD, 0,
+                   PAIR_QUERY_STATIC_THRESHOLD_ARGS),
+         LC29_KEEP(static_spd_thrshld, 0, 1, 0)},
+    [LC29_PAIR_SET_NAVIGATION_MODE] =
+        {LC29_PAIR(PAIR_COMMON_SET_NAVIGATION_MODE, 80, LC29_NO_FRAME, 1, 0),
+         .args = {LC29_ARG_NAV_MODE}, LC29_KEEP(nav_mode, 0, 1, 0)},
+    [LC29_PAIR_GET_NAVIGATION_MODE] =
+        {LC29_PAIR(PAIR_COMMON_GET_NAVIGATION_MODE, 81,
+                   LC29_FRAME_GET_NAVIGATION_MODE, 0,
+                   PAIR_QUERY_NAVIGATION_MODE_ARGS),
+         LC29_KEEP(nav_mode, 0, 1, 0)},
+    [LC29_PAIR_SET_NMEA_POS_DECIMAL_PRECISION] =
+        {LC29_PAIR(PAIR_COMMON_SET_NMEA_POS_DECIMAL_PRECISION, 98,
+                   LC29_NO_FRAME, 1, 0),
+         .args = {LC29_ARG_DECIMAL_PRECISION},
+         LC29_KEEP(decimal_accuracy, 0, 1, 0)},
+    [LC29_PAIR_GET_NMEA_POS_DECIMAL_PRECISION] =
+        {LC29_PAIR(PAIR_COMMON_GET_NMEA_POS_DECIMAL_PRECISION, 99,
+                   LC29_FRAME_GET_NMEA_POS_DECIMAL_PRECISION, 0,
+                   PAIR_QUERY_NMEA_DECIMAL_PRECISION_ARGS),
+         LC29_KEEP(decimal_accuracy, 0, 1, 0)},
+    [LC29_PAIR_SET_NMEA_OUTPUT_MODE] =
+        {LC29_PAIR(PAIR_COMMON_SET_NMEA_OUTPUT_MODE, 100, LC29_NO_FRAME, 2, 0),
+         .args = {LC29_ARG_NMEA_MODE, LC29_ARG_BOOL},
+         LC29_KEEP(nmea_output_mode, 0, 1, 0)},
+    [LC29_PAIR_GET_NMEA_OUTPUT_MODE] =
+        {LC29_PAIR(PAIR_COMMON_GET_NMEA_OUTPUT_MODE, 101,
+                   LC29_FRAME_GET_NMEA_OUTPUT_MODE, 0,
+                   PAIR_QUERY_NMEA_OUTPUT_MODE_ARGS),
+         LC29_KEEP(nmea_output_mode, 0, 1, 0)},
+    [LC29_PAIR_SET_DUAL_BAND] = {LC29_PAIR(PAIR_COMMON_SET_DUAL_BAND, 104,
+                                           LC29_NO_FRAME, 1, 0),
+                                 .args = {LC29_ARG_BOOL},
+                                 LC29_KEEP(dual_band_enable, 0, 1,
+                                           LC29_STATE_BOOL)},
+    [LC29_PAIR_GET_DUAL_BAND] = {LC29_PAIR(PAIR_COMMON_GET_DUAL_BAND, 105,
+                                           LC29_FRAME_GET_DUAL_BAND, 0,
+                                           PAIR_QUERY_DUAL_BAND_MODE_ARGS),
+                                 LC29_KEEP(dual_band_enable, 0, 1,
+                                           LC29_STATE_BOOL)},
+    [LC29_PAIR_SET_SBAS] = {LC29_PAIR(PAIR_SBAS_ENABLE, 410, LC29_NO_FRAME, 1,
+                                      0),
+                            .args = {LC29_ARG_BOOL},
+                            LC29_KEEP(sbas_enable, 0, 1, LC29_STATE_BOOL)},
+    [LC29_PAIR_GET_SBAS_STATUS] = {LC29_PAIR(PAIR_SBAS_GET_STATUS, 411,
+                                             LC29_FRAME_GET_SBAS_STATUS, 0,
+                                             PAIR_QUERY_SBAS_STATUS_ARGS),
+                                   LC29_KEEP(sbas_enable, 0, 1,
+                                             LC29_STATE_BOOL)},
+    [LC29_PAIR_SET_EASY] = {LC29_PAIR(PAIR_EASY_ENABLE, 490, LC29_NO_FRAME, 1,
+                                      0),
+                            .args = {LC29_ARG_BOOL},
+                            LC29_KEEP(easy_enable, 0, 1, LC29_STATE_BOOL)},
+    [LC29_PAIR_GET_EASY_STATUS] = {LC29_PAIR(PAIR_EASY_GET_STATUS, 491,
+                                             LC29_FRAME_GET_EASY_STATUS, 0,
+                                             PAIR_QUERY_EASY_STATUS_ARGS),
+                                   .query_min_args =
+                                       PAIR_QUERY_EASY_STATUS_MIN_ARGS,
+                                   .keep = lc29_driver_keep_easy_status},
+    [LC29_PAIR_NVM_SAVE_SETTING] = {LC29_PAIR(PAIR_NVM_SAVE_SETTING, 513,
+                                              LC29_FRAME_NVM_SAVE_SETTING, 0,
+                                              0)},
+    [LC29_PAIR_ENTER_RTC_MODE] = {LC29_PAIR(PAIR_LOW_POWER_ENTER_RTC_MODE, 650,
+                                            LC29_NO_FRAME, 1, 0),
+                                  .args = {LC29_ARG_RTC_SECONDS},
+                                  LC29_KEEP(low_pwr_rtc_clk, 0, 1, 0)},
+    [LC29_PAIR_SET_BAUDRATE] = {LC29_PAIR(PAIR_IO_SET_BAUDRATE, 864,
+                                          LC29_NO_FRAME, 3, 0),
+                                .args = {LC29_ARG_ZERO, LC29_ARG_PORT_INDEX,
+                                         LC29_ARG_BAUD_RATE},
+                                LC29_KEEP(baud_rate, 2, 1, 0)},
+    [LC29_PAIR_GET_BAUDRATE] = {LC29_PAIR(PAIR_IO_GET_BAUDRATE, 865,
+                                          LC29_FRAME_GET_UART0_BAUDRATE, 0,
+                                          PAIR_QUERY_BAUD_RATE_NUM_ARGS),
+                                LC29_KEEP(baud_rate, 0, 1, 0)},
+    [LC29_PAIR_SET_CUSTOM_MSG_OUTPUT] =
+        {LC29_PAIR(PAIR_SET_CUSTOM_MSG_OUTPUT, 6010, LC29_NO_FRAME, 2, 0),
+         .args = {LC29_ARG_CUSTOM_MSG, LC29_ARG_BOOL},
+         LC29_KEEP_INDEXED(dr_rtk_custom_message_settings.vehicle_info.enabled,
+                           qc_lc29x_pqtm_custom_message_output_t,
+                           LC29_STATE_BOOL)},
+    [LC29_PAIR_GET_CUSTOM_MSG_OUTPUT] =
+        {LC29_PAIR(PAIR_GET_CUSTOM_MSG_OUTPUT, 6011, LC29_NO_FRAME, 1,
+                   PAIR_QUERY_CUSTOM_MSG_OUTPUT),
+         .args = {LC29_ARG_CUSTOM_MSG},
+         LC29_KEEP_INDEXED(dr_rtk_custom_message_settings.vehicle_info.enabled,
+                           qc_lc29x_pqtm_custom_message_output_t,
+                           LC29_STATE_BOOL)},
+    [LC29_PQTM_SET_MESSAGE_OUTPUT] =
+        {LC29_PAIR(LC29_DR_PQTM_MESSAGE_CONFIG_HEADER, -1, LC29_NO_FRAME, 5,
+                   0),
+         .args = {LC29_ARG_ONE, LC29_ARG_BOOL, LC29_ARG_BOOL, LC29_ARG_BOOL,
+                  LC29_ARG_PQTM_RATE},
+         .keep = lc29_driver_keep_pqtm_output},
+    [LC29_PQTM_GET_MESSAGE_OUTPUT] =
+        {LC29_PAIR(LC29_DR_PQTM_MESSAGE_CONFIG_HEADER, -1,
+                   LC29_FRAME_DR_GET_PQTM_MESSAGE_CONFIG, 0,
+                   LC29_DR_QUERY_PQTM_CONFIG_RESPONSE_ARGS),
+         .query_header = LC29_DR_PQTM_MESSAGE_CONFIG_RESPONSE_HEADER,
+         .keep = lc29_driver_keep_pqtm_output},
+};
+
+typedef struct {
+  uint32_t min;
+  uint32_t max;
+} qc_lc29x_arg_range_s;
+
+static const qc_lc29x_arg_range_s lc29_arg_ranges[LC29_ARG_TYPE_COUNT] = {
+    [LC29_ARG_ZERO] = {0, 0},
+    [LC29_ARG_ONE] = {1, 1},
+    [LC29_ARG_BOOL] = {0, 1},
+    [LC29_ARG_FIX_INTERVAL] = {100, 1000},
+    [LC29_ARG_MIN_SNR] = {9, 49},
+    [LC29_ARG_NMEA_TYPE] = {NMEA_SEN_GGA, NMEA_SEN_VTG},
+    [LC29_ARG_NMEA_RATE] = {0, 20},
+    [LC29_ARG_SPEED_THRESHOLD] = {0, 20},
+    [LC29_ARG_NAV_MODE] = {NORMAL_MODE, SWIMMING_MODE},
+    [LC29_ARG_DECIMAL_PRECISION] = {LAT_LON_4_ALT_1, LAT_LON_7_ALT_3},
+    [LC29_ARG_NMEA_MODE] = {DISABLE_NMEA_OUTPUT, ENABLE_ASCII_NMEA_3_01},
+    [LC29_ARG_RTC_SECONDS] = {0, 62208000}, // 720 days
+    [LC29_ARG_PORT_INDEX] = {0, UINT8_MAX},
+    [LC29_ARG_BAUD_RATE] = {LC29_BAUD_RATE_4800, LC29_BAUD_RATE_115200},
+    [LC29_ARG_CUSTOM_MSG] = {PQTMVEHMSG, PQTMVEHMOT},
+    [LC29_ARG_PQTM_RATE] = {1, 100},
+};
+
+static bool lc29_driver_arg_valid(uint8_t type, uint32_t value) {
+  if (type >= LC29_ARG_TYPE_COUNT || value < lc29_arg_ranges[type].min ||
+      value > lc29_arg_ranges[type].max) {
+    return false;
+  }
+
+  // Types whose range has holes
+  switch (type) {
+  case LC29_ARG_NAV_MODE:
+    return NORMAL_MODE == value || FITNESS_MODE == value ||
+           STATIONARY_MODE == value || SWIMMING_MODE == value;
+  case LC29_ARG_RTC_SECONDS:
+    return 0 == value || value >= 10;
+  case LC29_ARG_BAUD_RATE:
+    return LC29_BAUD_RATE_4800 == value || LC29_BAUD_RATE_9600 == value ||
+           LC29_BAUD_RATE_19200 == value || LC29_BAUD_RATE_38400 == value ||
+           LC29_BAUD_RATE_57600 == value || LC29_BAUD_RATE_115200 == value;
+  case LC29_ARG_PQTM_RATE:
+    return 1 == value || 2 == value || 4 == value || 5 == value ||
+           10 == value || 20 == value || 50 == value || 100 == value;
+  default:
+    return true;
   }
+}
 
+/* Copies the values a command reported or was given into the driver */
+static qc_lc29x_ack_reponse_t
+lc29_driver_keep_state(qc_lc29_driver_s *driver,
+                       const qc_lc29x_pair_cmd_desc_s *desc,
+                       const int *values) {
+  uint8_t *field = (uint8_t *)driver + desc->state_offset;
+
+  if (desc->state_flags & LC29_STATE_INDEXED) {
+    // Value 0 is the same kind as argument 0, a result for another is refused
+    if (values[0] < 0 ||
+        !lc29_driver_arg_valid(desc->args[0], (uint32_t)values[0])) {
+      return CMD_SEND_FAIL;
+    }
+    field += (size_t)values[0] * desc->state_stride;
+  }
+
+  for (uint8_t i = 0; i < desc->state_count; i++, field += desc->state_size) {
+    int value = values[desc->state_first + i];
+
+    if (desc->state_flags & LC29_STATE_BOOL) {
+      bool enabled = 0 != value;
+      memcpy(field, &enabled, sizeof(enabled));
+    } else if (1 == desc->state_size) {
+      uint8_t value_u8 = (uint8_t)value;
+      memcpy(field, &value_u8, sizeof(value_u8));
+    } else if (2 == desc->state_size) {
+      uint16_t value_u16 = (uint16_t)value;
+      memcpy(field, &value_u16, sizeof(value_u16));
+    } else {
+      uint32_t value_u32 = (uint32_t)value;
+      memcpy(field, &value_u32, sizeof(value_u32));
+    }
+  }
   return CMD_SEND_SUCCESS;
 }
 
 /*
-Acknowledges a PAIR command. An acknowledgement packet PAIR_ACK is returned to
-inform the sender that the receiver has received the packet.
+  Writes a PQTM command of the registry and reads its $<header>OK, followed
+  by the query result of a GET. ERROR or any other reply fails the command.
 */
-qc_lc29x_response_error_t lc29_driver_validate_string(char *pair_id,
-                                                      const char *sentence,
-                                                      size_t length,
-                                                      int check_checksum) {
-  /* should have atleast 9 characters */
-  if (9 > length) {
-    return LC_RESPONSE_INVALID_LENGTH;
-  }
+static qc_lc29x_ack_reponse_t
+lc29_driver_pqtm_exchange(qc_lc29_driver_s *driver,
+                          const qc_lc29x_pair_cmd_desc_s *desc,
+                          const char *frame, size_t length, int query_min_args,
+                          int *values, int *num_values) {
+  qc_lc29x_sentence_view_s response;
+  size_t header_length = strlen(desc->header) - 1; // without the '$'
 
-  /* should start with $ */
-  if ('$' != *sentence) {
-    return LC_RESPONSE_INVALID_START_CHAR;
+  if (lc29_driver_write_all(driver, frame, length) != DRIVER_SUCCESS ||
+      lc29_driver_read_sentence(driver, LC29_SENTENCE_PQTM_RESPONSE,
+                                &response) != DRIVER_SUCCESS) {
+    return CMD_SEND_FAIL;
   }
-  /* should end with \r\n, or other... */
-  if (strcmp(&sentence[length - 4], "\r\n") == 0) {
-    return LC_RESPONSE_INVALID_R_N;
+  if (response.info->id_length != header_length + 2 ||
+      memcmp(&response.data[1], &desc->header[1], header_length) != 0 ||
+      memcmp(&response.data[1 + header_length], "OK", 2) != 0) {
+    return CMD_SEND_FAIL;
   }
-
-  // Verify that the input string starts with '$PAIR001,' or general PAIR CMD ID
-  if (strncmp(sentence, pair_id, 8) != 0) {
-    return LC_RESPONSE_INVALID_IDENTIFIER; // Invalid input string format
+  if (0 == desc->query_num_args) {
+    return CMD_SEND_SUCCESS;
   }
 
-  // /* should have a comma after the type word */
-  // if (',' != sentence[8]) {
-  //   return LC_RESPONSE_INVALID_IDENTIFIER;
-  // }
-  /* check for checksum */
-  if (0 != lc29_driver_response_has_checksum(sentence, length)) {
-    return LC_RESPONSE_NO_CHECKSUM;
+  if (lc29_driver_read_sentence(driver, LC29_SENTENCE_PQTM_RESPONSE,
+                                &response) != DRIVER_SUCCESS ||
+      lc29_driver_query_fields(
+          response.data, response.info,
+          NULL != desc->query_header ? desc->query_header : desc->header,
+          query_min_args, desc->query_num_args, values) != VALID_RESPONSE) {
+    return CMD_SEND_FAIL;
   }
+  *num_values = response.info->num_fields - 1;
+  return CMD_SEND_SUCCESS;
+}
 
-  if (1 == check_checksum) {
-    uint8_t actual_chk;
-    uint8_t expected_chk;
-    char checksum[3];
+/*
+  Runs one command of the registry: args holds its num_args arguments, which
+  are checked against their types before anything is sent. The command is
+  built from its header (or taken from lc29_command_frames), sent and its
+  PAIR_ACK and query result awaited like any other blocking command, see
+  lc29_driver_pqtm_exchange() for PQTM commands. Once it succeeded the
+  described driver field is updated.
+*/
+qc_lc29x_ack_reponse_t lc29_driver_execute(qc_lc29_driver_s *driver,
+                                           qc_lc29x_pair_cmd_t cmd,
+                                           const uint32_t *args) {
+  const qc_lc29x_pair_cmd_desc_s *desc;
+  int values[PAIR_QUERY_MAX_ARGS];
+  int num_values = 0;
+  int query_min_args;
+  char payload[LC29_CMD_MAX_LENGTH];
+  const char *frame = payload;
+  size_t length;
+  qc_lc29x_ack_reponse_t cmd_response;
 
-    checksum[0] = sentence[length - 4];
-    checksum[1] = sentence[length - 3];
-    checksum[2] = '\0';
-    actual_chk = lc29_driver_get_checksum(sentence);
-    expected_chk = (uint8_t)strtol(checksum, NULL, 16);
+  if ((unsigned)cmd >= LC29_PAIR_CMD_COUNT) {
+    return CMD_INVALID;
+  }
+  desc = &lc29_pair_cmds[cmd];
+  query_min_args =
+      desc->query_min_args > 0 ? desc->query_min_args : desc->query_num_args;
 
-    if (expected_chk != actual_chk) {
-      return LC_RESPONSE_INVALID_CHECKSUM;
+  for (uint8_t i = 0; i < desc->num_args; i++) {
+    if (!lc29_driver_arg_valid(desc->args[i], args[i])) {
+      return CMD_INVALID;
     }
   }
-  return VALID_RESPONSE;
-}
 
-char *Lc29_driver_crop_sentence(char *sentence, size_t length) {
-  /* Skip type word, 7 characters (including $ and ,) */
-  sentence += 8;
-  /* Find the where the * is located and crop accordingly */
-  char *ret = strchr(sentence, (int)'*');
-  if (ret == NULL) {
-    *sentence = '\0';
-    return sentence;
+  if (desc->frame != LC29_NO_FRAME) {
+    frame = lc29_command_frames[desc->frame].data;
+    length = lc29_command_frames[desc->frame].length;
   } else {
-    *ret = '\0';
-  }
-  return sentence;
-}
+    qc_lc29x_command_s command;
 
-int lc29_driver_parse_string_by_comma(int cmd_id_len, char *string, int *values,
-                                      int max_values) {
-  // Skip beginning command_id chars $PAIRXXX,
-  string += cmd_id_len;
-  int i = 0;
-  char *string_val = string;
+    lc29_command_begin(&command, payload, sizeof(payload), desc->header);
+    for (uint8_t i = 0; i < desc->num_args; i++) {
+      lc29_command_arg_uint(&command, args[i]);
+    }
+    length = lc29_command_end(&command);
+    if (0 == length) {
+      return CMD_SEND_FAIL;
+    }
+  }
 
-  while (i < max_values && NULL != (string = strchr(string, ','))) {
-    *string = '\0';
-    values[i] = atoi(string_val);
-    string_val = ++string;
-    i++;
+  if (desc->cmd_id < 0) {
+    cmd_response = lc29_driver_pqtm_exchange(
+        driver, desc, frame, length, query_min_args, values, &num_values);
+  } else {
+    cmd_response = lc29_driver_submit_and_wait(
+        driver, frame, length, desc->cmd_id,
+        desc->query_num_args > 0 ? desc->header : NULL, query_min_args,
+        desc->query_num_args, values, &num_values);
   }
-  // Capture the ending chars before checksum...
-  if (NULL != (string = strchr(string_val, '*'))) {
-    *string = '\0';
-    values[i] = atoi(string_val);
-    i++;
+  if (cmd_response != CMD_SEND_SUCCESS) {
+    return cmd_response;
   }
 
-  return i;
-}
-
-uint8_t lc29_driver_response_has_checksum(const char *sentence, size_t length) {
-  if ('*' == sentence[length - 5]) {
-    return 0;
+  // A SET command keeps what it was given
+  if (0 == desc->query_num_args) {
+    for (uint8_t i = 0; i < desc->num_args; i++) {
+      values[i] = (int)args[i];
+    }
+    num_values = desc->num_args;
+  } else if ((desc->state_flags & LC29_STATE_INDEXED) &&
+             (values[0] < 0 || (uint32_t)values[0] != args[0])) {
+    // The result must be for the element that was asked for
+    return CMD_SEND_FAIL;
   }
-  return LC_RESPONSE_NO_CHECKSUM;
-}
-
-uint8_t lc29_driver_get_checksum(const char *sentence) {
-  const char *n = sentence + 1;
-  uint8_t chk = 0;
 
-  /* While current char isn't '*' or sentence ending (newline) */
-  while ('*' != *n && LC29_RESPONSE_END_CHAR != *n && '\0' != *n) {
-    chk ^= (uint8_t)*n;
-    n++;
+  cmd_response = lc29_driver_keep_state(driver, desc, values);
+  if (CMD_SEND_SUCCESS == cmd_response && desc->keep != NULL) {
+    desc->keep(driver, values, num_values);
   }
-
-  return chk;
+  return cmd_response;
 }
 
 /*
-  Construct a method that takes a variable number of inputs in and then
-  constructs the PAIR CMD...
-  Note: cmd sentence is built based on the order the
-  args are passed into the array and assumes the values are NOT comma
-  seperated...
+  Sends one of the constant frames. PAIR commands wait for their PAIR_ACK like
+  every other command (a query result that follows is skipped), PQTM commands
+  are only written.
 */
-qc_lc29x_response_error_t lc29_driver_build_pair_cmd(uint8_t num_args,
-                                                     char *cmd_id, char *args[],
-                                                     char *cmd_result) {
-
-  char checksum[3];
-  char *csv_seperator = ",";
-
-  // Append the sentence header
-  strcat(cmd_result, cmd_id);
-
-  // Append the arguments
-  for (u_int8_t i = 0; i < num_args; i++) {
-
-    strcat(cmd_result, csv_seperator);
-    strcat(cmd_result, args[i]);
+qc_lc29x_ack_reponse_t lc29_driver_send_constant(qc_lc29_driver_s *driver,
+                                                 qc_lc29x_frame_id_t frame_id) {
+  if ((unsigned)frame_id >= LC29_FRAME_COUNT) {
+    return CMD_INVALID;
   }
 
-  // Append sentence ending char
-  strcat(cmd_result, PAIR_CMD_ENDING_CHAR);
-  // Get checksum
-  uint8_t checksum_i = lc29_driver_get_checksum(cmd_result);
-  sprintf(checksum, "%02X", checksum_i);
-  strcat(cmd_result, checksum);
-  strcat(cmd_result, LC29_CMD_END_CHARS);
-
-  // Perform PAIR_CMD integrity check
-  return lc29_driver_validate_string(cmd_id, cmd_result, strlen(cmd_result),
-                                     checksum_i);
+  const qc_lc29x_frame_s *frame = &lc29_command_frames[frame_id];
+  if (frame->cmd_id < 0) {
+    return lc29_driver_write_all(driver, frame->data, frame->length) ==
+                   DRIVER_SUCCESS
+               ? CMD_SEND_SUCCESS
+               : CMD_SEND_FAIL;
+  }
+  return lc29_driver_submit_and_wait(driver, frame->data, frame->length,
+                                     frame->cmd_id, NULL, 0, 0, NULL, NULL);
 }
 
 /*
-  Method to clean up the code to handle the transmission and verification of
-  $PAIR commands.
+  Pipelined form of lc29_driver_send_constant(), see
+  lc29_driver_submit_query(). Only PAIR frames can be submitted, PQTM commands
+  have no PAIR_ACK to complete them.
 */
-// qc_lc29x_response_error_t lc29_driver_transmit_cmd(char *cmd_payload,
-//                                                    char *cmd_response,
-//                                                    int cmd_id) {
-
-// // Step 2: Send query request
-// if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-//     DRIVER_SUCCESS) {
-//   return CMD_SEND_FAIL;
-// }
-
-// // Step 3: Validate Command Response
-// if (driver->lc29_driver_read(driver_cmd_response,
-//                              strlen(driver_cmd_response)) != DRIVER_SUCCESS)
-//                              {
-//   return CMD_SEND_FAIL;
-// }
-
-// // Step 4: Check for command acceptance
-// cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-// if (cmd_response != CMD_SEND_SUCCESS) {
-//   return cmd_response;
-// }
+qc_lc29x_ack_reponse_t
+lc29_driver_submit_constant(qc_lc29_driver_s *driver,
+                            qc_lc29x_frame_id_t frame_id, const char *query_id,
+                            int query_num_args,
+                            qc_lc29x_command_callback_t callback,
+                            void *context) {
+  if ((unsigned)frame_id >= LC29_FRAME_COUNT ||
+      lc29_command_frames[frame_id].cmd_id < 0 ||
+      NULL == driver->lc29_driver_clock_ms) {
+    return CMD_INVALID;
+  }
 
-//   return CMD_SEND_SUCCESS;
-// }
+  const qc_lc29x_frame_s *frame = &lc29_command_frames[frame_id];
+  return lc29_driver_submit_frame(driver, frame->data, frame->length,
+                                  frame->cmd_id, query_id, query_num_args,
+                                  callback, context, NULL);
+}
 
 // Driver Set Methods
 
+/*
+  Numeric argument of the string based setters, up to max. Each of them is a
+  wrapper around the typed setter, which does the range check and writes the
+  number straight into the command.
+*/
+static bool lc29_driver_string_uint(const char *value, uint32_t max,
+                                    uint32_t *result) {
+  size_t length = NULL != value ? strlen(value) : 0;
+  return length > 0 && length <= 10 &&
+         lc29_fixed_uint32(value, (uint8_t)length, result) && *result <= max;
+}
+
 /*
 Sets position fix interval. The ULP (Ultra Low Power) mode only supports 1 Hz.
 Type: Set. Synopsis: $PAIR050,<Time>*<Checksum><CR><LF>
@@ -431,40 +1616,22 @@ Example:
 $PAIR050,1000*12
 $PAIR001,050,0*3E
 */
-qc_lc29x_ack_reponse_t lc29_driver_set_fix_rate(qc_lc29_driver_s *driver,
-                                                char *fix_rate) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char fix_rate_packet[50] = {0};
-  char *args[] = {fix_rate};
+qc_lc29x_ack_reponse_t lc29_driver_set_fix_interval(qc_lc29_driver_s *driver,
+                                                    uint16_t interval_ms) {
+  const uint32_t args[] = {interval_ms};
 
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_COMMON_SET_FIX_RATE, args,
-                                 fix_rate_packet) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
+  return lc29_driver_execute(driver, LC29_PAIR_SET_FIX_RATE, args);
+}
 
-  // Send request
-  if (driver->lc29_driver_write(fix_rate_packet, strlen(fix_rate_packet)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
+/* String form of lc29_driver_set_fix_interval() */
+qc_lc29x_ack_reponse_t lc29_driver_set_fix_rate(qc_lc29_driver_s *driver,
+                                                char *fix_rate) {
+  uint32_t interval_ms;
 
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 50);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
+  if (!lc29_driver_string_uint(fix_rate, UINT16_MAX, &interval_ms)) {
+    return CMD_INVALID;
   }
-
-  // update driver config
-  driver->fix_rate = atoi(fix_rate);
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_set_fix_interval(driver, (uint16_t)interval_ms);
 }
 
 /*
@@ -486,46 +1653,22 @@ Example:
 $PAIR058,15*1F
 $PAIR001,058,0*36
 */
+qc_lc29x_ack_reponse_t lc29_driver_set_min_snr_dbhz(qc_lc29_driver_s *driver,
+                                                    uint8_t min_snr) {
+  const uint32_t args[] = {min_snr};
+
+  return lc29_driver_execute(driver, LC29_PAIR_SET_MIN_SNR, args);
+}
+
+/* String form of lc29_driver_set_min_snr_dbhz() */
 qc_lc29x_ack_reponse_t lc29_driver_set_min_snr(qc_lc29_driver_s *driver,
                                                char *min_snr) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char min_snr_packet[50] = {0};
-  char *args[] = {min_snr};
+  uint32_t min_snr_i;
 
-  uint16_t min_snr_i = atoi(min_snr);
-  // Check to ensure SNR remains within bounds...
-  if (min_snr_i < 9 || min_snr_i > 49) {
+  if (!lc29_driver_string_uint(min_snr, UINT8_MAX, &min_snr_i)) {
     return CMD_INVALID;
   }
-
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_COMMON_SET_MIN_SNR, args,
-                                 min_snr_packet) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(min_snr_packet, strlen(min_snr_packet)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 58);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->min_snr = min_snr_i;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_set_min_snr_dbhz(driver, (uint8_t)min_snr_i);
 }
 
 /*
@@ -558,75 +1701,26 @@ Example:
  $PAIR001,062,0*3F
 */
 qc_lc29x_ack_reponse_t
+lc29_driver_set_nmea_output_interval(qc_lc29_driver_s *driver,
+                                     qc_lc29x_nmea_output_rate_id_t rate_id,
+                                     uint8_t output_rate) {
+  const uint32_t args[] = {(uint32_t)rate_id, output_rate};
+
+  return lc29_driver_execute(driver, LC29_PAIR_SET_NMEA_OUTPUT_RATE, args);
+}
+
+/* String form of lc29_driver_set_nmea_output_interval() */
+qc_lc29x_ack_reponse_t
 lc29_driver_set_nmea_output_rate(qc_lc29_driver_s *driver, char *output_rate_id,
                                  char *output_rate) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char nmea_output_rate_packet[50] = {0};
-
-  // Check to ensure output ID is valid remains within bounds...
-  qc_lc29x_nmea_output_rate_id_t rate_id =
-      (qc_lc29x_nmea_output_rate_id_t)atoi(output_rate_id);
-  if (rate_id > 5 || rate_id < 0) {
-    return CMD_INVALID;
-  }
+  uint32_t rate_id, output_rate_i;
 
-  // Check to ensure output rate remains within bounds...
-  uint16_t output_rate_i = atoi(output_rate);
-  if (output_rate_i > 20) {
+  if (!lc29_driver_string_uint(output_rate_id, NMEA_SEN_VTG, &rate_id) ||
+      !lc29_driver_string_uint(output_rate, UINT8_MAX, &output_rate_i)) {
     return CMD_INVALID;
   }
-
-  char *args[] = {output_rate_id, output_rate};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(2, PAIR_COMMON_SET_NMEA_OUTPUT_RATE, args,
-                                 nmea_output_rate_packet) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(nmea_output_rate_packet,
-                                strlen(nmea_output_rate_packet)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 62);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  switch (rate_id) {
-  case NMEA_SEN_GGA:
-    driver->nmea_output_rate.gga.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_GLL:
-    driver->nmea_output_rate.gll.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_GSA:
-    driver->nmea_output_rate.gsa.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_GSV:
-    driver->nmea_output_rate.gsv.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_RMC:
-    driver->nmea_output_rate.rmc.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_VTG:
-    driver->nmea_output_rate.vtg.output_rate = output_rate_i;
-    break;
-  default:
-    break;
-  }
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_set_nmea_output_interval(
+      driver, (qc_lc29x_nmea_output_rate_id_t)rate_id, (uint8_t)output_rate_i);
 }
 
 /*
@@ -675,51 +1769,14 @@ with PAIR104,0, the following GNSS search modes are supported:
 qc_lc29x_ack_reponse_t lc29_driver_set_gnss_search_mode(
     qc_lc29_driver_s *driver,
     qc_lc29x_gnss_search_mode_s search_mode_settings) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char gnss_search_mode_packet[50] = {0};
-  // char default_param
-  char *args[] = {search_mode_settings.gps_enabled ? "1" : "0",
-                  search_mode_settings.glonass_enabled ? "1" : "0",
-                  search_mode_settings.galileo_enabled ? "1" : "0",
-                  search_mode_settings.beidou_enabled ? "1" : "0",
-                  search_mode_settings.qzss_enabled ? "1" : "0",
-                  "0"};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(6, PAIR_COMMON_SET_GNSS_SEARCH_MODE, args,
-                                 gnss_search_mode_packet) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(gnss_search_mode_packet,
-                                strlen(gnss_search_mode_packet)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 66);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->gnss_search_mode.gps_enabled = search_mode_settings.gps_enabled;
-  driver->gnss_search_mode.glonass_enabled =
-      search_mode_settings.glonass_enabled;
-  driver->gnss_search_mode.galileo_enabled =
-      search_mode_settings.galileo_enabled;
-  driver->gnss_search_mode.beidou_enabled = search_mode_settings.beidou_enabled;
-  driver->gnss_search_mode.qzss_enabled = search_mode_settings.qzss_enabled;
-  driver->gnss_search_mode.reserved = false;
-
-  return CMD_SEND_SUCCESS;
+  const uint32_t args[] = {search_mode_settings.gps_enabled,
+                           search_mode_settings.glonass_enabled,
+                           search_mode_settings.galileo_enabled,
+                           search_mode_settings.beidou_enabled,
+                           search_mode_settings.qzss_enabled,
+                           0};
+
+  return lc29_driver_execute(driver, LC29_PAIR_SET_GNSS_SEARCH_MODE, args);
 }
 
 /*
@@ -742,47 +1799,23 @@ $PAIR070,4*25
 $PAIR001,070,0*3C
 */
 qc_lc29x_ack_reponse_t
+lc29_driver_set_static_threshold_dms(qc_lc29_driver_s *driver,
+                                     uint8_t speed_threshold) {
+  const uint32_t args[] = {speed_threshold};
+
+  return lc29_driver_execute(driver, LC29_PAIR_SET_STATIC_THRESHOLD, args);
+}
+
+/* String form of lc29_driver_set_static_threshold_dms() */
+qc_lc29x_ack_reponse_t
 lc29_driver_set_static_threshold(qc_lc29_driver_s *driver,
                                  char *speed_threshold) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char static_spd_thshld_packet[50] = {0};
-  char *args[] = {speed_threshold};
+  uint32_t spd_threshold_i;
 
-  uint16_t spd_threshold_i = atoi(speed_threshold);
-  // Check to ensure SNR remains within bounds...
-  if (spd_threshold_i > 20) {
+  if (!lc29_driver_string_uint(speed_threshold, UINT8_MAX, &spd_threshold_i)) {
     return CMD_INVALID;
   }
-
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_COMMON_SET_STATIC_THRESHOLD, args,
-                                 static_spd_thshld_packet) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(static_spd_thshld_packet,
-                                strlen(static_spd_thshld_packet)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 70);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->static_spd_thrshld = spd_threshold_i;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_set_static_threshold_dms(driver, (uint8_t)spd_threshold_i);
 }
 
 /*
@@ -811,55 +1844,9 @@ $PAIR001,080,0*33
 qc_lc29x_ack_reponse_t
 lc29_driver_set_navigation_mode(qc_lc29_driver_s *driver,
                                 qc_lc29x_nav_mode_t nav_mode) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-  char *arg;
-  // Determine arg based on nav_mode_t
-  switch (nav_mode) {
-  case NORMAL_MODE:
-    arg = "0";
-    break;
-  case FITNESS_MODE:
-    arg = "1";
-    break;
-  case STATIONARY_MODE:
-    arg = "4";
-    break;
-  case SWIMMING_MODE:
-    arg = "7";
-    break;
-  default:
-    return CMD_INVALID;
-  }
-
-  char *args[] = {arg};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_COMMON_SET_NAVIGATION_MODE, args,
-                                 payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 80);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->nav_mode = nav_mode;
+  const uint32_t args[] = {(uint32_t)nav_mode};
 
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_SET_NAVIGATION_MODE, args);
 }
 
 /*
@@ -883,55 +1870,10 @@ $PAIR001,098,0*3A
 qc_lc29x_ack_reponse_t
 lc29_driver_set_nmea_decimal_precision(qc_lc29_driver_s *driver,
                                        qc_lc29x_dec_accuracy_t accuracy) {
+  const uint32_t args[] = {(uint32_t)accuracy};
 
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-  char *arg;
-  // Determine arg based on nav_mode_t
-  switch (accuracy) {
-  case LAT_LON_4_ALT_1:
-    arg = "0";
-    break;
-  case LAT_LON_5_ALT_2:
-    arg = "1";
-    break;
-  case LAT_LON_6_ALT_3:
-    arg = "2";
-    break;
-  case LAT_LON_7_ALT_3:
-    arg = "3";
-    break;
-  default:
-    return CMD_INVALID;
-  }
-
-  char *args[] = {arg};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_COMMON_SET_NMEA_POS_DECIMAL_PRECISION,
-                                 args, payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(payload, sizeof(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 98);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->decimal_accuracy = accuracy;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_SET_NMEA_POS_DECIMAL_PRECISION,
+                             args);
 }
 
 /*
@@ -958,53 +1900,9 @@ qc_lc29x_ack_reponse_t
 lc29_driver_set_nmea_output_mode(qc_lc29_driver_s *driver,
                                  qc_nmea_output_mode nmea_output_mode,
                                  bool proprietary_mode) {
+  const uint32_t args[] = {(uint32_t)nmea_output_mode, proprietary_mode};
 
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-  char *arg;
-  // Determine arg based on nav_mode_t
-  switch (nmea_output_mode) {
-  case DISABLE_NMEA_OUTPUT:
-    arg = "0";
-    break;
-  case ENABLE_ASCII_NMEA_4_10:
-    arg = "1";
-    break;
-  case ENABLE_ASCII_NMEA_3_01:
-    arg = "2";
-    break;
-  default:
-    return CMD_INVALID;
-  }
-
-  char *args[] = {arg, proprietary_mode ? "1" : "0"};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(2, PAIR_COMMON_SET_NMEA_OUTPUT_MODE, args,
-                                 payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 100);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->nmea_output_mode = nmea_output_mode;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_SET_NMEA_OUTPUT_MODE, args);
 }
 
 /*
@@ -1029,37 +1927,9 @@ $PAIR001,104,0*3E
 */
 qc_lc29x_ack_reponse_t lc29_driver_set_dual_band_mode(qc_lc29_driver_s *driver,
                                                       bool enable) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-
-  char *args[] = {enable ? "1" : "0"};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_COMMON_SET_DUAL_BAND, args, payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 104);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->dual_band_enable = enable;
+  const uint32_t args[] = {enable};
 
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_SET_DUAL_BAND, args);
 }
 
 /*
@@ -1084,37 +1954,9 @@ $PAIR001,490,0*36
 */
 qc_lc29x_ack_reponse_t lc29_driver_set_sbas_mode(qc_lc29_driver_s *driver,
                                                  bool enable) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-
-  char *args[] = {enable ? "1" : "0"};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_SBAS_ENABLE, args, payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 410);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
+  const uint32_t args[] = {enable};
 
-  // update driver config
-  driver->sbas_enable = enable;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_SET_SBAS, args);
 }
 
 /*
@@ -1145,37 +1987,9 @@ $PAIR001,490,0*36
 */
 qc_lc29x_ack_reponse_t lc29_driver_set_easy_status(qc_lc29_driver_s *driver,
                                                    bool enable) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-
-  char *args[] = {enable ? "1" : "0"};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_EASY_ENABLE, args, payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
+  const uint32_t args[] = {enable};
 
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 490);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // update driver config
-  driver->easy_enable = enable;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_SET_EASY, args);
 }
 
 /*
@@ -1193,34 +2007,8 @@ $PAIR001,513,0*3C
 */
 qc_lc29x_ack_reponse_t lc29_driver_nvm_save_setting(qc_lc29_driver_s *driver,
                                                     bool enable) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-
-  // char *args[] = {};
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_NVM_SAVE_SETTING, NULL, payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 513);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  return CMD_SEND_SUCCESS;
+  (void)enable;
+  return lc29_driver_execute(driver, LC29_PAIR_NVM_SAVE_SETTING, NULL);
 }
 
 /*
@@ -1250,48 +2038,22 @@ Example:
 $PAIR650,2*27
 $PAIR001,650,4*3C
 */
-qc_lc29x_ack_reponse_t lc29_driver_set_low_power_mode(qc_lc29_driver_s *driver,
-                                                      char *wakeup_time) {
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-  char *args[] = {wakeup_time};
-
-  // Check to ensure SNR remains within bounds...
-  uint32_t wakeup_time_i = (uint32_t)atoi(wakeup_time);
-
-  if (wakeup_time_i != 0) {
-    if (wakeup_time_i < 10 || wakeup_time_i > 62208000) {
-      return CMD_INVALID;
-    }
-  }
+qc_lc29x_ack_reponse_t lc29_driver_set_rtc_wakeup(qc_lc29_driver_s *driver,
+                                                  uint32_t wakeup_time) {
+  const uint32_t args[] = {wakeup_time};
 
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_LOW_POWER_ENTER_RTC_MODE, args,
-                                 payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
+  return lc29_driver_execute(driver, LC29_PAIR_ENTER_RTC_MODE, args);
+}
 
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
+/* String form of lc29_driver_set_rtc_wakeup() */
+qc_lc29x_ack_reponse_t lc29_driver_set_low_power_mode(qc_lc29_driver_s *driver,
+                                                      char *wakeup_time) {
+  uint32_t wakeup_time_i;
 
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 650);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
+  if (!lc29_driver_string_uint(wakeup_time, UINT32_MAX, &wakeup_time_i)) {
+    return CMD_INVALID;
   }
-
-  // update driver config
-  driver->low_pwr_rtc_clk = wakeup_time_i;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_set_rtc_wakeup(driver, wakeup_time_i);
 }
 
 /*
@@ -1316,42 +2078,29 @@ Example:
 $PAIR864,0,0,115200*1B
 $PAIR001,864,0*31
 */
+qc_lc29x_ack_reponse_t lc29_driver_set_uart_baud_rate(qc_lc29_driver_s *driver,
+                                                      uint8_t port_index,
+                                                      uint32_t baud_rate) {
+  const uint32_t args[] = {0, port_index, baud_rate}; // UART
+
+  return lc29_driver_execute(driver, LC29_PAIR_SET_BAUDRATE, args);
+}
+
+/* String form of lc29_driver_set_uart_baud_rate() */
 qc_lc29x_ack_reponse_t lc29_driver_set_io_baudrate(qc_lc29_driver_s *driver,
                                                    char *port_type,
                                                    char *port_index,
                                                    char *baud_rate) {
+  uint32_t port_type_i, port_index_i, baud_rate_i;
 
-  qc_lc29x_ack_reponse_t cmd_response;
-  char driver_cmd_response[22] = {0};
-  char payload[50] = {0};
-  char *args[] = {port_type, port_index, baud_rate};
-
-  // Build PAIR Command
-  if (lc29_driver_build_pair_cmd(3, PAIR_IO_SET_BAUDRATE, args, payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Send request
-  if (driver->lc29_driver_write(payload, strlen(payload)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Get LC29 response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               sizeof(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-  // Validate response
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 864);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
+  // UART is the only port type
+  if (!lc29_driver_string_uint(port_type, 0, &port_type_i) ||
+      !lc29_driver_string_uint(port_index, UINT8_MAX, &port_index_i) ||
+      !lc29_driver_string_uint(baud_rate, UINT32_MAX, &baud_rate_i)) {
+    return CMD_INVALID;
   }
-
-  // update driver config
-  driver->baud_rate = atoi(baud_rate);
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_set_uart_baud_rate(driver, (uint8_t)port_index_i,
+                                        baud_rate_i);
 }
 
 // Driver Get Methods
@@ -1382,54 +2131,7 @@ $PAIR051,1000*13
 
 */
 qc_lc29x_ack_reponse_t lc29_driver_get_fix_rate(qc_lc29_driver_s *driver) {
-
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_FIX_RATE, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 51);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_FIX_RATE, strlen(query_response),
-          PAIR_QUERY_FIX_RATE_NUM_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-
-    return CMD_SEND_FAIL;
-  }
-
-  driver->fix_rate = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_FIX_RATE, NULL);
 }
 
 /*
@@ -1456,53 +2158,7 @@ $PAIR059,15*1E
 
 */
 qc_lc29x_ack_reponse_t lc29_driver_get_min_snr(qc_lc29_driver_s *driver) {
-
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_MIN_SNR, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, 59);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_MIN_SNR, strlen(query_response),
-          PAIR_QUERY_MIN_SNR_NUM_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  driver->min_snr = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_MIN_SNR, NULL);
 }
 
 /*
@@ -1551,55 +2207,7 @@ $PAIR865,115200*1A
 
 */
 qc_lc29x_ack_reponse_t lc29_driver_get_baudrate(qc_lc29_driver_s *driver) {
-  const int cmd_id = 865;
-
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {"0", "0"};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_IO_GET_BAUDRATE, args, cmd_payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, strlen(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_IO_GET_BAUDRATE, strlen(query_response),
-          PAIR_QUERY_BAUD_RATE_NUM_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-
-    return CMD_SEND_FAIL;
-  }
-
-  driver->baud_rate = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_BAUDRATE, NULL);
 }
 
 /*
@@ -1650,88 +2258,12 @@ $PAIR063,0,3*3C
 
 qc_lc29x_ack_reponse_t
 lc29_driver_get_nmea_output_rate(qc_lc29_driver_s *driver, char *nmea_rate_id) {
-  const uint8_t cmd_id = 63;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
+  uint32_t rate_id;
 
-  // Check to ensure output ID is valid remains within bounds...
-  qc_lc29x_nmea_output_rate_id_t rate_id =
-      (qc_lc29x_nmea_output_rate_id_t)atoi(nmea_rate_id);
-  if (rate_id > 5 || rate_id < 0) {
+  if (!lc29_driver_string_uint(nmea_rate_id, NMEA_SEN_VTG, &rate_id)) {
     return CMD_INVALID;
   }
-
-  char *args[] = {nmea_rate_id};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_NMEA_OUTPUT_RATE, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, strlen(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_NMEA_OUTPUT_RATE,
-          strlen(query_response), PAIR_QUERY_NMEA_RATE_NUM_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-
-    return CMD_SEND_FAIL;
-  }
-
-  rate_id = (qc_lc29x_nmea_output_rate_id_t)query_response_vals[0];
-
-  uint16_t output_rate_i = query_response_vals[1];
-
-  // update driver config
-  switch (rate_id) {
-  case NMEA_SEN_GGA:
-    driver->nmea_output_rate.gga.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_GLL:
-    driver->nmea_output_rate.gll.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_GSA:
-    driver->nmea_output_rate.gsa.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_GSV:
-    driver->nmea_output_rate.gsv.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_RMC:
-    driver->nmea_output_rate.rmc.output_rate = output_rate_i;
-    break;
-  case NMEA_SEN_VTG:
-    driver->nmea_output_rate.vtg.output_rate = output_rate_i;
-    break;
-  default:
-    break;
-  }
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_NMEA_OUTPUT_RATE, &rate_id);
 }
 
 /*
@@ -1759,59 +2291,7 @@ $PAIR067,1,0,0,0,0,0*3A
 */
 qc_lc29x_ack_reponse_t
 lc29_driver_get_gnss_search_mode(qc_lc29_driver_s *driver) {
-  const uint8_t cmd_id = 67;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_GNSS_SEARCH_MODE, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_GNSS_SEARCH_MODE,
-          strlen(query_response), PAIR_QUERY_MIN_SNR_NUM_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // update driver config
-  driver->gnss_search_mode.gps_enabled = query_response_vals[0];
-  driver->gnss_search_mode.glonass_enabled = query_response_vals[1];
-  driver->gnss_search_mode.galileo_enabled = query_response_vals[2];
-  driver->gnss_search_mode.beidou_enabled = query_response_vals[3];
-  driver->gnss_search_mode.qzss_enabled = query_response_vals[4];
-  driver->gnss_search_mode.reserved = false;
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_GNSS_SEARCH_MODE, NULL);
 }
 
 /*
@@ -1836,54 +2316,7 @@ $PAIR071,0*20
 */
 qc_lc29x_ack_reponse_t
 lc29_driver_get_static_threshold(qc_lc29_driver_s *driver) {
-  const uint8_t cmd_id = 71;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_STATIC_THRESHOLD, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_STATIC_THRESHOLD,
-          strlen(query_response), PAIR_QUERY_STATIC_THRESHOLD_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // update driver config
-  driver->static_spd_thrshld = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_STATIC_THRESHOLD, NULL);
 }
 
 /*
@@ -1920,54 +2353,7 @@ $PAIR081,0*2F
 */
 qc_lc29x_ack_reponse_t
 lc29_driver_get_navigation_mode(qc_lc29_driver_s *driver) {
-  const uint8_t cmd_id = 81;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_NAVIGATION_MODE, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_NAVIGATION_MODE,
-          strlen(query_response), PAIR_QUERY_STATIC_THRESHOLD_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // update driver config
-  driver->nav_mode = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_NAVIGATION_MODE, NULL);
 }
 
 /*
@@ -1998,60 +2384,27 @@ $PAIR099,3*25
 */
 qc_lc29x_ack_reponse_t
 lc29_driver_get_NMEA_decimal_precision(qc_lc29_driver_s *driver) {
-  const uint8_t cmd_id = 99;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_NMEA_POS_DECIMAL_PRECISION,
-                                 args, cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_NMEA_POS_DECIMAL_PRECISION,
-          strlen(query_response), PAIR_QUERY_NMEA_DECIMAL_PRECISION_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
+  return lc29_driver_execute(driver, LC29_PAIR_GET_NMEA_POS_DECIMAL_PRECISION,
+                             NULL);
+}
 
-  // update driver config
-  driver->nav_mode = query_response_vals[0];
+/*
+2.4.27. Packet Type: 101 PAIR_COMMON_GET_NMEA_OUTPUT_MODE
+Queries NMEA output mode.
+Type: Get.
+Synopsis: $PAIR101*<Checksum><CR><LF>
 
-  return CMD_SEND_SUCCESS;
-}
+Query result message format:
+$PAIR101,<NMEA_Mode>,<PROPRIETARY_Mode>*<Checksum><CR><LF>
 
-// TODO (@Kibby) - Not a high priority at the moment to support
+Example:
+$PAIR101*3A
+$PAIR001,101,0*3B
+$PAIR101,1,0*3B
+*/
 qc_lc29x_ack_reponse_t
 lc29_driver_get_nmea_output_mode(qc_lc29_driver_s *driver) {
-  return 0;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_NMEA_OUTPUT_MODE, NULL);
 }
 
 /*
@@ -2078,54 +2431,7 @@ $PAIR105,1*23
 */
 qc_lc29x_ack_reponse_t
 lc29_driver_get_dual_band_mode(qc_lc29_driver_s *driver) {
-  const uint8_t cmd_id = 105;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_COMMON_GET_DUAL_BAND, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_COMMON_GET_DUAL_BAND, strlen(query_response),
-          PAIR_QUERY_DUAL_BAND_MODE_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // update driver config
-  driver->dual_band_enable = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_DUAL_BAND, NULL);
 }
 
 /*
@@ -2150,54 +2456,7 @@ $PAIR001,411,0*3F
 $PAIR411,2*21
 */
 qc_lc29x_ack_reponse_t lc29_driver_get_sbas_mode(qc_lc29_driver_s *driver) {
-  const int cmd_id = 411;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_SBAS_GET_STATUS, args, cmd_payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_SBAS_GET_STATUS, strlen(query_response),
-          PAIR_QUERY_SBAS_STATUS_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // update driver config
-  driver->sbas_enable = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_SBAS_STATUS, NULL);
 }
 
 /*
@@ -2234,54 +2493,7 @@ after executing this command.
 
 */
 qc_lc29x_ack_reponse_t lc29_driver_get_easy_satus(qc_lc29_driver_s *driver) {
-  const int cmd_id = 491;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {0};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(0, PAIR_EASY_GET_STATUS, args, cmd_payload) !=
-      VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_EASY_GET_STATUS, strlen(query_response),
-          PAIR_QUERY_EASY_STATUS_ARGS,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // update driver config
-  driver->easy_status = query_response_vals[0];
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_EASY_STATUS, NULL);
 }
 
 /*
@@ -2344,9 +2556,10 @@ Navigation type.
 // NOTE (@Kibby): This method is rebuilt as the original parse_cmd_response only
 // supports $PAIR001 cmds...
 qc_lc29x_ack_reponse_t
-lc29_driver_parse_dr_cmd_response(char *response_string,
-                                  int response_string_len, char *dr_cmd_id,
-                                  int dr_cmd_id_len, int check_checksum) {
+lc29_driver_parse_dr_cmd_response(const char *response_string,
+                                  int response_string_len,
+                                  const char *dr_cmd_id, int dr_cmd_id_len,
+                                  int check_checksum) {
 
   int response_cmd_id, response_cmd_status;
 
@@ -2359,35 +2572,26 @@ lc29_driver_parse_dr_cmd_response(char *response_string,
     return CMD_SEND_FAIL;
   }
   /* should end with \r\n, or other... */
-  if (strcmp(&response_string[response_string_len - 4], "\r\n") == 0) {
+  qc_lc29x_parser_s parser;
+  qc_lc29x_parse_result_t result =
+      lc29_parser_parse(&parser, response_string, response_string_len);
+  if (LC29_PARSE_IN_PROGRESS == result) {
     return CMD_SEND_FAIL;
   }
 
   // Verify that the input string starts with input CMD ID
-  if (strncmp(response_string, dr_cmd_id, dr_cmd_id_len) != 0) {
+  if (parser.info.id_length != dr_cmd_id_len - 1 ||
+      strncmp(&response_string[1], &dr_cmd_id[1], dr_cmd_id_len - 1) != 0) {
     return CMD_SEND_FAIL; // Invalid input string format
   }
 
   // received string integrity check...
-  if (0 !=
-      lc29_driver_response_has_checksum(response_string, response_string_len)) {
+  if (LC29_PARSE_NO_CHECKSUM == result || LC29_PARSE_MALFORMED == result) {
     return CMD_SEND_FAIL;
   }
 
-  if (1 == check_checksum) {
-    uint8_t actual_chk;
-    uint8_t expected_chk;
-    char checksum[3];
-
-    checksum[0] = response_string[response_string_len - 4];
-    checksum[1] = response_string[response_string_len - 3];
-    checksum[2] = '\0';
-    actual_chk = lc29_driver_get_checksum(response_string);
-    expected_chk = (uint8_t)strtol(checksum, NULL, 16);
-
-    if (expected_chk != actual_chk) {
-      return CMD_SEND_FAIL;
-    }
+  if (1 == check_checksum && LC29_PARSE_INVALID_CHECKSUM == result) {
+    return CMD_SEND_FAIL;
   }
 
   return CMD_SEND_SUCCESS;
@@ -2466,77 +2670,31 @@ versions dedicated for two-wheel vehicles. Contact Quectel Technical Support
 3. type: "1:true" set or "0:false" get
 */
 
+/* Sets the $PQTMINS/$PQTMIMU/$PQTMGPS output, rate_hz as listed for <Rate> */
+qc_lc29x_ack_reponse_t
+lc29_driver_set_pqtm_message_output(qc_lc29_driver_s *driver, bool ins_enabled,
+                                    bool imu_enabled, bool gps_enabled,
+                                    uint8_t rate_hz) {
+  const uint32_t args[] = {1, ins_enabled, imu_enabled, gps_enabled, rate_hz};
+
+  return lc29_driver_execute(driver, LC29_PQTM_SET_MESSAGE_OUTPUT, args);
+}
+
+/* A GET sends $PQTMCFGEINSMSG,0 and keeps the queried settings */
 qc_lc29x_ack_reponse_t
 lc29_driver_set_get_pqtm_message_settings(qc_lc29_driver_s *driver, bool type,
                                           bool ins_enabled, bool imu_enabled,
                                           bool gps_enabled, char *rate) {
-  // const uint8_t cmd_id = 491;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {type ? "1" : "0", ins_enabled ? "1" : "0",
-                  imu_enabled ? "1" : "0", gps_enabled ? "1" : "0", rate};
-
-  // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(5, LC29_DR_PQTM_MESSAGE_CONFIG_HEADER, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
+  uint32_t rate_i;
 
-  // The expected command response here is $PQTMCFGEINSMSGOK*16... This
-  if (lc29_driver_parse_dr_cmd_response(
-          driver_cmd_response, strlen(driver_cmd_response), LC29_DR_RESPONSE_OK,
-          strlen(LC29_DR_RESPONSE_OK), 1) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
+  if (!lc29_driver_string_uint(rate, UINT8_MAX, &rate_i)) {
+    return CMD_INVALID;
   }
-
-  if (!type) {
-    // Step 4: Validate and parse query response,
-    if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-        DRIVER_SUCCESS) {
-      return CMD_SEND_FAIL;
-    }
-    // TODO: Update these parameters to support the proper expected response
-    if (lc29_driver_parse_query_response(
-            query_response, LC29_DR_PQTM_MESSAGE_CONFIG_RESPONSE_HEADER,
-            strlen(query_response), LC29_DR_QUERY_PQTM_CONFIG_RESPONSE_ARGS,
-            query_response_vals) != CMD_SEND_SUCCESS) {
-      return CMD_SEND_FAIL;
-    }
-
-    // update driver config
-    driver->dr_rtk_output_rate.ins.enabled = query_response_vals[1];
-    driver->dr_rtk_output_rate.ins.fix_rate = query_response_vals[4];
-    driver->dr_rtk_output_rate.imu.enabled = query_response_vals[2];
-    driver->dr_rtk_output_rate.imu.fix_rate = query_response_vals[4];
-    driver->dr_rtk_output_rate.gps.enabled = query_response_vals[3];
-    driver->dr_rtk_output_rate.gps.enabled =
-        query_response_vals[4] > 10 ? 10 : query_response_vals[4];
+  if (type) {
+    return lc29_driver_set_pqtm_message_output(driver, ins_enabled, imu_enabled,
+                                               gps_enabled, (uint8_t)rate_i);
   }
-
-  // update driver config
-  driver->dr_rtk_output_rate.ins.enabled = ins_enabled;
-  driver->dr_rtk_output_rate.ins.fix_rate = atoi(rate);
-  driver->dr_rtk_output_rate.imu.enabled = imu_enabled;
-  driver->dr_rtk_output_rate.imu.fix_rate = atoi(rate);
-  driver->dr_rtk_output_rate.gps.enabled = gps_enabled;
-  driver->dr_rtk_output_rate.gps.fix_rate = atoi(rate) > 10 ? 10 : atoi(rate);
-
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PQTM_GET_MESSAGE_OUTPUT, NULL);
 }
 
 /*
@@ -2576,67 +2734,13 @@ only output once after each boot-up.
 qc_lc29x_ack_reponse_t
 lc29_driver_set_dr_rtk_message_output(qc_lc29_driver_s *driver, char *msg_type,
                                       bool msg_type_output_state) {
-  const int cmd_id = 6010;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {msg_type, msg_type_output_state ? "1" : "0"};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(2, PAIR_SET_CUSTOM_MSG_OUTPUT, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  qc_lc29x_dr_custom_message_id_t msg_id =
-      (qc_lc29x_dr_custom_message_id_t)atoi(msg_type);
+  uint32_t args[2];
 
-  switch (msg_id) {
-  case PQTMVEHMSG:
-    driver->dr_rtk_custom_message_settings.vehicle_info.enabled =
-        msg_type_output_state;
-    break;
-  case PQTMSENMSG:
-    driver->dr_rtk_custom_message_settings.sensor_output.enabled =
-        msg_type_output_state;
-    break;
-  case PQTMDRCAL:
-    driver->dr_rtk_custom_message_settings.dr_calibration.enabled =
-        msg_type_output_state;
-    break;
-  case PQTMIMUTYPE:
-    driver->dr_rtk_custom_message_settings.imu_type.enabled =
-        msg_type_output_state;
-    break;
-  case PQTMVEHMOT:
-    driver->dr_rtk_custom_message_settings.dr_vehicle_motion.enabled =
-        msg_type_output_state;
-    break;
-  default:
-    return CMD_SEND_FAIL;
-    break;
+  if (!lc29_driver_string_uint(msg_type, PQTMVEHMOT, &args[0])) {
+    return CMD_INVALID;
   }
-
-  return CMD_SEND_SUCCESS;
+  args[1] = msg_type_output_state;
+  return lc29_driver_execute(driver, LC29_PAIR_SET_CUSTOM_MSG_OUTPUT, args);
 }
 
 /*
@@ -2689,77 +2793,10 @@ versions dedicated for four-wheel vehicles. Contact Quectel Technical Support
 qc_lc29x_ack_reponse_t
 lc29_driver_get_dr_rtk_message_output(qc_lc29_driver_s *driver,
                                       char *msg_type) {
-  const int cmd_id = 6011;
-  char driver_cmd_response[22] = {0};
-  char cmd_payload[50] = {0};
-  char query_response[50] = {0};
-  int query_response_vals[10]; // To be passed into the parse query response
-  qc_lc29x_ack_reponse_t cmd_response;
-  char *args[] = {msg_type};
-
-  // // Step 1: Build PAIR Command
-  if (lc29_driver_build_pair_cmd(1, PAIR_GET_CUSTOM_MSG_OUTPUT, args,
-                                 cmd_payload) != VALID_RESPONSE) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 2: Send query request
-  if (driver->lc29_driver_write(cmd_payload, strlen(cmd_payload)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  // Step 3: Validate Command Response
-  if (driver->lc29_driver_read(driver_cmd_response,
-                               strlen(driver_cmd_response)) != DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  cmd_response = lc29_driver_parse_response(driver_cmd_response, cmd_id);
-  if (cmd_response != CMD_SEND_SUCCESS) {
-    return cmd_response;
-  }
-
-  // Step 4: Validate and parse query response
-  if (driver->lc29_driver_read(query_response, sizeof(query_response)) !=
-      DRIVER_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  if (lc29_driver_parse_query_response(
-          query_response, PAIR_GET_CUSTOM_MSG_OUTPUT, strlen(query_response),
-          PAIR_QUERY_CUSTOM_MSG_OUTPUT,
-          query_response_vals) != CMD_SEND_SUCCESS) {
-    return CMD_SEND_FAIL;
-  }
-
-  qc_lc29x_dr_custom_message_id_t msg_id =
-      (qc_lc29x_dr_custom_message_id_t)query_response_vals[0];
+  uint32_t msg_id;
 
-  switch (msg_id) {
-  case PQTMVEHMSG:
-    driver->dr_rtk_custom_message_settings.vehicle_info.enabled =
-        query_response_vals[1];
-    break;
-  case PQTMSENMSG:
-    driver->dr_rtk_custom_message_settings.sensor_output.enabled =
-        query_response_vals[1];
-    break;
-  case PQTMDRCAL:
-    driver->dr_rtk_custom_message_settings.dr_calibration.enabled =
-        query_response_vals[1];
-    break;
-  case PQTMIMUTYPE:
-    driver->dr_rtk_custom_message_settings.imu_type.enabled =
-        query_response_vals[1];
-    break;
-  case PQTMVEHMOT:
-    driver->dr_rtk_custom_message_settings.dr_vehicle_motion.enabled =
-        query_response_vals[1];
-    break;
-  default:
-    return CMD_SEND_FAIL;
-    break;
+  if (!lc29_driver_string_uint(msg_type, PQTMVEHMOT, &msg_id)) {
+    return CMD_INVALID;
   }
-  return CMD_SEND_SUCCESS;
+  return lc29_driver_execute(driver, LC29_PAIR_GET_CUSTOM_MSG_OUTPUT, &msg_id);
 }
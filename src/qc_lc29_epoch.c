@@ -0,0 +1,248 @@
+/*
+  Quectel GNSS LC29X Epoch Assembler
+
+  Time stamped sentences (GGA, RMC) and sentences that come once per fix
+  (GGA, RMC, VTG) mark where a fix starts; GSA and GSV come several times
+  per fix and are merged into the fix in progress. Every sentence merged is
+  summarised in a signature (part, talker and for GSA/GSV which system and
+  signal, and whether a GSV sequence ended), the one seen last before a fix
+  starts is the signature that closes a fix.
+*/
+
+#include "qc_lc29_epoch.h"
+#include "qc_lc29_sentence_id.h"
+#include <string.h>
+
+// Set in a signature for a GSV sentence that ends its sequence
+#define LC29_EPOCH_SEQUENCE_END 0x80u
+
+static void lc29_epoch_reset(qc_lc29x_epoch_s *epoch) {
+  epoch->utc_epoch_ns = 0;
+  epoch->utc_time_ms = 0;
+  epoch->parts = 0;
+  epoch->has_time = false;
+  epoch->complete = false;
+  lc29_nmea_gsa_reset(&epoch->gsa);
+  lc29_nmea_gsv_table_reset(&epoch->gsv);
+}
+
+void lc29_epoch_init(qc_lc29x_epoch_assembler_s *assembler, uint16_t expected,
+                     qc_lc29x_dec_accuracy_t precision,
+                     qc_lc29x_epoch_callback_t callback, void *context) {
+  memset(assembler, 0, sizeof(*assembler));
+  lc29_epoch_reset(&assembler->epoch);
+  lc29_nmea_date_cache_init(&assembler->date_cache);
+  assembler->epoch.expected = expected;
+  assembler->precision = precision;
+  assembler->callback = callback;
+  assembler->context = context;
+}
+
+void lc29_epoch_configure(qc_lc29x_epoch_assembler_s *assembler,
+                          const qc_lc29_driver_s *driver) {
+  const qc_lc29x_nmea_output_rate_s *nmea =
+      lc29_driver_nmea_output_rates(driver);
+  const qc_lc29x_pqtm_output_rate_t *ins =
+      &lc29_driver_dr_output_rates(driver)->ins;
+  uint16_t expected = 0;
+
+  // Output rate 1 is every fix, n > 1 every n-th one
+  expected |= 1 == nmea->gga.output_rate ? LC29_EPOCH_GGA : 0;
+  expected |= 1 == nmea->rmc.output_rate ? LC29_EPOCH_RMC : 0;
+  expected |= 1 == nmea->gsa.output_rate ? LC29_EPOCH_GSA : 0;
+  expected |= 1 == nmea->gsv.output_rate ? LC29_EPOCH_GSV : 0;
+  expected |= 1 == nmea->vtg.output_rate ? LC29_EPOCH_VTG : 0;
+  // The INS rate is in Hz, the fix interval in ms
+  if (ins->enabled &&
+      ins->fix_rate * (int)lc29_driver_fix_interval(driver) >= 1000) {
+    expected |= LC29_EPOCH_INS;
+  }
+
+  assembler->epoch.expected = expected;
+  assembler->precision = lc29_driver_decimal_accuracy(driver);
+}
+
+static void lc29_epoch_handler(void *context,
+                               const qc_lc29x_sentence_view_s *sentence) {
+  lc29_epoch_feed(context, sentence);
+}
+
+qc_lc29x_driver_response_t
+lc29_epoch_attach(qc_lc29x_epoch_assembler_s *assembler,
+                  qc_lc29_driver_s *driver) {
+  lc29_epoch_configure(assembler, driver);
+  if (lc29_driver_set_sentence_handler(driver, LC29_SENTENCE_NMEA,
+                                       lc29_epoch_handler,
+                                       assembler) != DRIVER_SUCCESS) {
+    return DRIVCER_FAIL;
+  }
+  return lc29_driver_set_sentence_handler(driver, LC29_SENTENCE_PQTM,
+                                          lc29_epoch_handler, assembler);
+}
+
+static void lc29_epoch_publish(qc_lc29x_epoch_assembler_s *assembler) {
+  qc_lc29x_epoch_s *epoch = &assembler->epoch;
+
+  if (assembler->has_ins) {
+    epoch->ins = assembler->ins;
+    epoch->parts |= LC29_EPOCH_INS;
+    assembler->has_ins = false;
+  }
+  epoch->complete = (epoch->parts & epoch->expected) == epoch->expected;
+  assembler->published = true;
+  assembler->epochs++;
+  assembler->incomplete += !epoch->complete;
+  if (assembler->callback != NULL) {
+    assembler->callback(assembler->context, epoch);
+  }
+}
+
+/* A new fix begins, what came last before it closes a fix from now on */
+static void lc29_epoch_next(qc_lc29x_epoch_assembler_s *assembler) {
+  if (!assembler->published) {
+    lc29_epoch_publish(assembler);
+  }
+  assembler->closing = assembler->last;
+  assembler->published = false;
+  lc29_epoch_reset(&assembler->epoch);
+}
+
+void lc29_epoch_flush(qc_lc29x_epoch_assembler_s *assembler) {
+  if (!assembler->published && assembler->epoch.parts != 0) {
+    lc29_epoch_publish(assembler);
+  }
+}
+
+static uint16_t lc29_epoch_part(const qc_lc29x_sentence_view_s *sentence) {
+  const char *type = &sentence->data[3];
+
+  if (LC29_ID_DR_NAV_RESULTS == sentence->info->id) {
+    return LC29_EPOCH_INS;
+  }
+  if (5 != sentence->info->id_length) {
+    return 0;
+  }
+  if (memcmp(type, "GGA", 3) == 0) {
+    return LC29_EPOCH_GGA;
+  }
+  if (memcmp(type, "RMC", 3) == 0) {
+    return LC29_EPOCH_RMC;
+  }
+  if (memcmp(type, "GSA", 3) == 0) {
+    return LC29_EPOCH_GSA;
+  }
+  if (memcmp(type, "GSV", 3) == 0) {
+    return LC29_EPOCH_GSV;
+  }
+  if (memcmp(type, "VTG", 3) == 0) {
+    return LC29_EPOCH_VTG;
+  }
+  return 0;
+}
+
+static uint32_t lc29_epoch_signature(const qc_lc29x_sentence_view_s *sentence,
+                                     uint16_t part, uint8_t detail) {
+  return part | (uint32_t)detail << 8 |
+         (uint32_t)(uint8_t)sentence->data[1] << 16 |
+         (uint32_t)(uint8_t)sentence->data[2] << 24;
+}
+
+qc_lc29x_nmea_result_t
+lc29_epoch_feed(qc_lc29x_epoch_assembler_s *assembler,
+                const qc_lc29x_sentence_view_s *sentence) {
+  qc_lc29x_epoch_s *epoch = &assembler->epoch;
+  qc_lc29x_nmea_result_t result;
+  uint16_t part = lc29_epoch_part(sentence);
+  uint8_t detail = 0;
+  qc_lc29x_pqtm_ins_s ins;
+  qc_lc29x_gga_s gga;
+  qc_lc29x_rmc_s rmc;
+  qc_lc29x_vtg_s vtg;
+  bool timed = false;
+  uint32_t time_ms = 0;
+
+  switch (part) {
+  case LC29_EPOCH_INS:
+    result = lc29_nmea_decode_pqtm_ins(sentence, &ins);
+    if (LC29_NMEA_OK == result) {
+      assembler->ins = ins;
+      assembler->has_ins = true;
+    } else {
+      assembler->errors++;
+    }
+    return result;
+  case LC29_EPOCH_GGA:
+    result = lc29_nmea_decode_gga(sentence, assembler->precision, &gga);
+    break;
+  case LC29_EPOCH_RMC:
+    result = lc29_nmea_decode_rmc(sentence, assembler->precision,
+                                  &assembler->date_cache, &rmc);
+    break;
+  case LC29_EPOCH_VTG:
+    result = lc29_nmea_decode_vtg(sentence, &vtg);
+    break;
+  case LC29_EPOCH_GSA:
+  case LC29_EPOCH_GSV:
+    // Merged straight into the epoch, they never start one
+    result = LC29_NMEA_OK;
+    break;
+  default:
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (result != LC29_NMEA_OK) {
+    assembler->errors++;
+    return result;
+  }
+  // Only read once the decoder has filled them in
+  if (LC29_EPOCH_GGA == part) {
+    timed = gga.has_time;
+    time_ms = gga.utc_time_ms;
+  } else if (LC29_EPOCH_RMC == part) {
+    timed = rmc.has_time;
+    time_ms = rmc.utc_time_ms;
+  }
+
+  if ((LC29_EPOCH_GSA | LC29_EPOCH_GSV) & part) {
+    // The same sentences of the same fix are told apart by system / signal
+    if (LC29_EPOCH_GSA == part) {
+      result = lc29_nmea_decode_gsa(sentence, &epoch->gsa);
+      detail = epoch->gsa.system_id;
+    } else {
+      result = lc29_nmea_decode_gsv(sentence, &epoch->gsv);
+      detail = (uint8_t)(epoch->gsv.sequence_signal |
+                         (0 == epoch->gsv.sequence_next
+                              ? LC29_EPOCH_SEQUENCE_END
+                              : 0));
+    }
+    if (result != LC29_NMEA_OK) {
+      assembler->errors++;
+      return result;
+    }
+  } else {
+    if ((epoch->parts & part) ||
+        (timed && epoch->has_time && time_ms != epoch->utc_time_ms)) {
+      lc29_epoch_next(assembler);
+    }
+    if (timed && !epoch->has_time) {
+      epoch->utc_time_ms = time_ms;
+      epoch->has_time = true;
+    }
+    if (LC29_EPOCH_GGA == part) {
+      epoch->gga = gga;
+    } else if (LC29_EPOCH_RMC == part) {
+      epoch->rmc = rmc;
+      epoch->utc_epoch_ns = rmc.utc_epoch_ns;
+    } else {
+      epoch->vtg = vtg;
+    }
+  }
+
+  epoch->parts |= part;
+  assembler->last = lc29_epoch_signature(sentence, part, detail);
+  if (assembler->published) {
+    assembler->late++;
+  } else if (assembler->last == assembler->closing) {
+    lc29_epoch_publish(assembler);
+  }
+  return LC29_NMEA_OK;
+}
@@ -0,0 +1,289 @@
+/*
+  Quectel GNSS LC29X Sentence Framer
+
+  Everything the module outputs (PAIR ACKs, query results, NMEA and PQTM
+  messages) shares the same framing:
+
+    $<Sentence>*<Checksum><CR><LF>
+
+  Framing follows the '$' start char and the '\n' end char. Bytes between two
+  frames (line ending left-overs, UART noise) are never stored. A '$' showing
+  up inside a frame means the previous sentence was cut short, so the partial
+  sentence is thrown away and framing restarts on the new '$'.
+  Sentences the parser rejects (bad checksum, malformed) are dropped as soon as
+  their last byte arrives.
+
+  Every stored sentence is followed by a '\0' inside the ring, which makes each
+  view a regular C string without having to copy it out first.
+
+  Complete sentences are classified and linked into the FIFO of their class.
+  Entries come from a shared pool, so a burst of NMEA output can use all of it
+  while no command is in flight. Since classes are drained independently, the
+  ring space of a sentence is only reused once every older sentence is gone
+  too; if the ring or the pool runs out, the oldest sentence is evicted.
+*/
+
+#include "qc_lc29_framer.h"
+#include "qc_lc29_sentence_id.h"
+#include <string.h>
+
+static uint8_t lc29_framer_oldest_class(const qc_lc29x_framer_s *framer) {
+  uint8_t oldest = LC29_SENTENCE_CLASS_COUNT;
+  uint32_t oldest_age = 0;
+
+  for (uint8_t i = 0; i < LC29_SENTENCE_CLASS_COUNT; i++) {
+    const qc_lc29x_framer_queue_s *queue = &framer->queues[i];
+    if (0 == queue->count) {
+      continue;
+    }
+    // Ages are measured back from the write position to survive wrap around
+    uint32_t age = framer->tail - framer->entries[queue->head].start;
+    if (LC29_SENTENCE_CLASS_COUNT == oldest || age > oldest_age) {
+      oldest = i;
+      oldest_age = age;
+    }
+  }
+  return oldest;
+}
+
+static uint32_t lc29_framer_retained_start(const qc_lc29x_framer_s *framer) {
+  uint8_t oldest = lc29_framer_oldest_class(framer);
+  if (oldest < LC29_SENTENCE_CLASS_COUNT) {
+    return framer->entries[framer->queues[oldest].head].start;
+  }
+  if (LC29_PARSER_IDLE != framer->parser.state) {
+    return framer->sentence_start;
+  }
+  return framer->tail;
+}
+
+static uint8_t lc29_framer_dequeue(qc_lc29x_framer_s *framer,
+                                   qc_lc29x_framer_queue_s *queue) {
+  uint8_t slot = queue->head;
+  queue->head = framer->entries[slot].next;
+  queue->count--;
+  if (0 == queue->count) {
+    queue->tail = LC29_FRAMER_NO_ENTRY;
+  }
+  framer->entry_count--;
+  return slot;
+}
+
+static void lc29_framer_release(qc_lc29x_framer_s *framer, uint8_t slot) {
+  framer->entries[slot].next = framer->free_entry;
+  framer->free_entry = slot;
+}
+
+static bool lc29_framer_evict_oldest(qc_lc29x_framer_s *framer) {
+  uint8_t oldest = lc29_framer_oldest_class(framer);
+  if (LC29_SENTENCE_CLASS_COUNT == oldest) {
+    return false;
+  }
+  lc29_framer_release(framer,
+                      lc29_framer_dequeue(framer, &framer->queues[oldest]));
+  framer->overruns++;
+  return true;
+}
+
+static bool lc29_framer_store(qc_lc29x_framer_s *framer, char c) {
+  while (framer->tail - lc29_framer_retained_start(framer) >=
+         LC29_FRAMER_CAPACITY) {
+    if (!lc29_framer_evict_oldest(framer)) {
+      return false;
+    }
+  }
+  framer->buffer[framer->tail & LC29_FRAMER_MASK] = c;
+  framer->tail++;
+  return true;
+}
+
+static void lc29_framer_abandon(qc_lc29x_framer_s *framer) {
+  // The partial sentence is always the newest data, just rewind over it
+  framer->tail = framer->sentence_start;
+  framer->parser.state = LC29_PARSER_IDLE;
+}
+
+static void lc29_framer_enqueue(qc_lc29x_framer_s *framer) {
+  if (LC29_FRAMER_NO_ENTRY == framer->free_entry) {
+    lc29_framer_evict_oldest(framer);
+  }
+
+  uint8_t slot = framer->free_entry;
+  qc_lc29x_framer_entry_s *entry = &framer->entries[slot];
+  framer->free_entry = entry->next;
+
+  entry->start = framer->sentence_start;
+  entry->length = (uint16_t)(framer->tail - 1 - framer->sentence_start);
+  entry->next = LC29_FRAMER_NO_ENTRY;
+  entry->info = framer->parser.info;
+
+  // Classifying reads the '$' and the identifier, mirror them if they wrap
+  uint32_t offset = entry->start & LC29_FRAMER_MASK;
+  uint32_t id_end = offset + 1 + entry->info.id_length;
+  if (id_end > LC29_FRAMER_CAPACITY) {
+    memcpy(&framer->buffer[LC29_FRAMER_CAPACITY], framer->buffer,
+           id_end - LC29_FRAMER_CAPACITY);
+  }
+  const char *data = &framer->buffer[offset];
+  entry->info.id = lc29_sentence_id(data, &entry->info);
+  qc_lc29x_framer_queue_s *queue =
+      &framer->queues[lc29_sentence_classify(data, &entry->info)];
+  if (0 == queue->count) {
+    queue->head = slot;
+  } else {
+    framer->entries[queue->tail].next = slot;
+  }
+  queue->tail = slot;
+  queue->count++;
+  framer->entry_count++;
+}
+
+void lc29_framer_init(qc_lc29x_framer_s *framer) {
+  framer->tail = 0;
+  framer->sentence_start = 0;
+  lc29_parser_init(&framer->parser);
+  for (uint8_t i = 0; i < LC29_FRAMER_MAX_SENTENCES; i++) {
+    framer->entries[i].next =
+        (i + 1 < LC29_FRAMER_MAX_SENTENCES) ? i + 1 : LC29_FRAMER_NO_ENTRY;
+  }
+  framer->free_entry = 0;
+  framer->entry_count = 0;
+  for (uint8_t i = 0; i < LC29_SENTENCE_CLASS_COUNT; i++) {
+    framer->queues[i].head = LC29_FRAMER_NO_ENTRY;
+    framer->queues[i].tail = LC29_FRAMER_NO_ENTRY;
+    framer->queues[i].count = 0;
+  }
+  framer->overruns = 0;
+  framer->dropped = 0;
+  framer->checksum_errors = 0;
+}
+
+/*
+  Pushes a single byte into the framer, cheap enough to be called from the UART
+  RX interrupt. Returns true when the byte completed a valid sentence.
+*/
+bool lc29_framer_push_byte(qc_lc29x_framer_s *framer, char c) {
+  if ('$' == c) {
+    if (LC29_PARSER_IDLE != framer->parser.state) {
+      // Previous sentence was cut short, resync on the new start char
+      lc29_framer_abandon(framer);
+      framer->dropped++;
+    }
+    framer->sentence_start = framer->tail;
+  } else if (LC29_PARSER_IDLE == framer->parser.state) {
+    return false;
+  }
+
+  if (!lc29_framer_store(framer, c)) {
+    lc29_framer_abandon(framer);
+    framer->dropped++;
+    return false;
+  }
+
+  qc_lc29x_parse_result_t result = lc29_parser_feed(&framer->parser, c);
+  if (LC29_PARSE_IN_PROGRESS == result) {
+    return false;
+  }
+
+  if (LC29_PARSE_SENTENCE_OK != result) {
+    // The parser already went back to idle, drop what was stored
+    framer->tail = framer->sentence_start;
+    if (LC29_PARSE_INVALID_CHECKSUM == result) {
+      framer->checksum_errors++;
+    } else {
+      framer->dropped++;
+    }
+    return false;
+  }
+
+  // Terminate the sentence in place so the view is a valid C string
+  if (!lc29_framer_store(framer, '\0')) {
+    framer->tail = framer->sentence_start;
+    framer->dropped++;
+    return false;
+  }
+
+  lc29_framer_enqueue(framer);
+  return true;
+}
+
+/*
+  Pushes a chunk of raw UART bytes into the framer. Returns the number of
+  sentences completed by this chunk.
+*/
+size_t lc29_framer_push(qc_lc29x_framer_s *framer, const char *data,
+                        size_t length) {
+  size_t completed = 0;
+
+  for (size_t i = 0; i < length; i++) {
+    completed += lc29_framer_push_byte(framer, data[i]);
+  }
+
+  return completed;
+}
+
+static void lc29_framer_view(qc_lc29x_framer_s *framer, uint8_t slot,
+                             qc_lc29x_sentence_class_t sentence_class,
+                             qc_lc29x_sentence_view_s *sentence) {
+  const qc_lc29x_framer_entry_s *entry = &framer->entries[slot];
+
+  uint32_t offset = entry->start & LC29_FRAMER_MASK;
+  // Length + 1 to bring the '\0' terminator along
+  uint32_t end = offset + entry->length + 1;
+  if (end > LC29_FRAMER_CAPACITY) {
+    memcpy(&framer->buffer[LC29_FRAMER_CAPACITY], framer->buffer,
+           end - LC29_FRAMER_CAPACITY);
+  }
+
+  sentence->data = &framer->buffer[offset];
+  sentence->length = entry->length;
+  sentence->sentence_class = sentence_class;
+  sentence->info = &entry->info;
+}
+
+/*
+  Pops the oldest sentence of the given class. A sentence that wraps around the
+  end of the ring has its wrapped part mirrored past the end of the ring so the
+  view is always contiguous; any other sentence is returned in place.
+  The entry goes back to the pool right away, its data stays untouched until
+  the next push.
+*/
+bool lc29_framer_next_class(qc_lc29x_framer_s *framer,
+                            qc_lc29x_sentence_class_t sentence_class,
+                            qc_lc29x_sentence_view_s *sentence) {
+  if (sentence_class >= LC29_SENTENCE_CLASS_COUNT ||
+      0 == framer->queues[sentence_class].count) {
+    return false;
+  }
+
+  uint8_t slot =
+      lc29_framer_dequeue(framer, &framer->queues[sentence_class]);
+  lc29_framer_view(framer, slot, sentence_class, sentence);
+  lc29_framer_release(framer, slot);
+  return true;
+}
+
+/*
+  Pops the oldest complete sentence whatever its class.
+*/
+bool lc29_framer_next(qc_lc29x_framer_s *framer,
+                      qc_lc29x_sentence_view_s *sentence) {
+  uint8_t oldest = lc29_framer_oldest_class(framer);
+  if (LC29_SENTENCE_CLASS_COUNT == oldest) {
+    return false;
+  }
+  return lc29_framer_next_class(framer, (qc_lc29x_sentence_class_t)oldest,
+                                sentence);
+}
+
+uint8_t lc29_framer_pending(const qc_lc29x_framer_s *framer) {
+  return framer->entry_count;
+}
+
+uint8_t lc29_framer_pending_class(const qc_lc29x_framer_s *framer,
+                                  qc_lc29x_sentence_class_t sentence_class) {
+  if (sentence_class >= LC29_SENTENCE_CLASS_COUNT) {
+    return 0;
+  }
+  return framer->queues[sentence_class].count;
+}
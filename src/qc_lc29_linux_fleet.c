@@ -0,0 +1,177 @@
+/*
+  Quectel GNSS LC29X Linux Fleet Manager
+
+  One epoll instance watches the tty of every member. The member index is
+  stored in the epoll data, so a ready fd leads straight to its driver without
+  any lookup; run time per loop only depends on the number of ready members.
+  Command deadlines of idle members are checked every
+  LC29_FLEET_EXPIRY_INTERVAL_MS, members with data are checked as part of
+  feeding their driver.
+*/
+
+#define _GNU_SOURCE
+
+#include "qc_lc29_linux_fleet.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+qc_lc29x_driver_response_t lc29_fleet_init(qc_lc29x_fleet_s *fleet,
+                                           qc_lc29x_fleet_member_s *members,
+                                           qc_lc29x_driver_storage_t *slots,
+                                           size_t capacity) {
+  fleet->epoll_fd = -1;
+  fleet->members = members;
+  fleet->capacity = capacity;
+  fleet->count = 0;
+  fleet->last_expiry_ms = lc29_linux_clock_ms();
+  for (size_t i = 0; i < capacity; i++) {
+    members[i].in_use = false;
+    members[i].driver = NULL;
+  }
+
+  // The pool first, a failed init then has nothing to close
+  if (lc29_driver_pool_init(&fleet->pool, slots, capacity) != capacity) {
+    return DRIVCER_FAIL;
+  }
+  fleet->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  return fleet->epoll_fd < 0 ? DRIVCER_FAIL : DRIVER_SUCCESS;
+}
+
+/*
+  Adds a module connected on an already open tty (left open by the fleet).
+  Returns the member index or -1.
+*/
+int lc29_fleet_add(qc_lc29x_fleet_s *fleet, int fd, uint32_t baud_rate) {
+  int member = -1;
+
+  for (size_t i = 0; i < fleet->capacity && member < 0; i++) {
+    if (!fleet->members[i].in_use) {
+      member = (int)i;
+    }
+  }
+  if (member < 0) {
+    return -1;
+  }
+
+  qc_lc29x_fleet_member_s *entry = &fleet->members[member];
+  if (lc29_linux_serial_attach(&entry->serial, fd, baud_rate) !=
+      DRIVER_SUCCESS) {
+    lc29_linux_serial_close(&entry->serial);
+    return -1;
+  }
+
+  entry->driver = Lc29_driver_pool_ctor(
+      &fleet->pool, &lc29_linux_serial_transport, &entry->serial);
+  if (NULL == entry->driver) {
+    lc29_linux_serial_close(&entry->serial);
+    return -1;
+  }
+  lc29_driver_set_clock(entry->driver, lc29_linux_clock_ms);
+
+  struct epoll_event event = {.events = EPOLLIN, .data.u32 = (uint32_t)member};
+  if (epoll_ctl(fleet->epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+    Lc29_driver_dtor(entry->driver);
+    entry->driver = NULL;
+    lc29_linux_serial_close(&entry->serial);
+    return -1;
+  }
+
+  entry->in_use = true;
+  fleet->count++;
+  return member;
+}
+
+/*
+  Opens and adds a module by tty path, the fleet closes the tty on removal.
+*/
+int lc29_fleet_open(qc_lc29x_fleet_s *fleet, const char *path,
+                    uint32_t baud_rate) {
+  int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+  if (fd < 0) {
+    return -1;
+  }
+
+  int member = lc29_fleet_add(fleet, fd, baud_rate);
+  if (member < 0) {
+    close(fd);
+    return -1;
+  }
+  fleet->members[member].serial.owns_fd = true;
+  return member;
+}
+
+qc_lc29_driver_s *lc29_fleet_driver(qc_lc29x_fleet_s *fleet, int member) {
+  if (member < 0 || (size_t)member >= fleet->capacity ||
+      !fleet->members[member].in_use) {
+    return NULL;
+  }
+  return fleet->members[member].driver;
+}
+
+void lc29_fleet_remove(qc_lc29x_fleet_s *fleet, int member) {
+  qc_lc29_driver_s *driver = lc29_fleet_driver(fleet, member);
+  if (NULL == driver) {
+    return;
+  }
+
+  qc_lc29x_fleet_member_s *entry = &fleet->members[member];
+  epoll_ctl(fleet->epoll_fd, EPOLL_CTL_DEL, entry->serial.fd, NULL);
+  lc29_linux_serial_close(&entry->serial);
+  Lc29_driver_dtor(driver);
+  entry->driver = NULL;
+  entry->in_use = false;
+  fleet->count--;
+}
+
+static void lc29_fleet_expire(qc_lc29x_fleet_s *fleet) {
+  uint32_t now = lc29_linux_clock_ms();
+  if (now - fleet->last_expiry_ms < LC29_FLEET_EXPIRY_INTERVAL_MS) {
+    return;
+  }
+  fleet->last_expiry_ms = now;
+
+  for (size_t i = 0; i < fleet->capacity; i++) {
+    qc_lc29x_fleet_member_s *entry = &fleet->members[i];
+    if (entry->in_use && lc29_driver_pending_cmds(entry->driver) > 0) {
+      lc29_driver_feed(entry->driver, NULL, 0);
+    }
+  }
+}
+
+/*
+  Waits up to timeout_ms for any member to have data, drains every ready
+  member into its driver and expires command deadlines. Returns the number of
+  members serviced, or -1 if epoll failed. A member whose tty fails is removed.
+*/
+int lc29_fleet_run_once(qc_lc29x_fleet_s *fleet, int timeout_ms) {
+  struct epoll_event events[LC29_FLEET_MAX_EVENTS];
+
+  int ready = epoll_wait(fleet->epoll_fd, events, LC29_FLEET_MAX_EVENTS,
+                         timeout_ms);
+  if (ready < 0) {
+    return EINTR == errno ? 0 : -1;
+  }
+
+  for (int i = 0; i < ready; i++) {
+    int member = (int)events[i].data.u32;
+    qc_lc29x_fleet_member_s *entry = &fleet->members[member];
+    if (lc29_linux_serial_drain(&entry->serial, entry->driver) < 0) {
+      lc29_fleet_remove(fleet, member);
+    }
+  }
+
+  lc29_fleet_expire(fleet);
+  return ready;
+}
+
+void lc29_fleet_close(qc_lc29x_fleet_s *fleet) {
+  for (size_t i = 0; i < fleet->capacity; i++) {
+    lc29_fleet_remove(fleet, (int)i);
+  }
+  if (fleet->epoll_fd >= 0) {
+    close(fleet->epoll_fd);
+  }
+  fleet->epoll_fd = -1;
+}
@@ -0,0 +1,306 @@
+/*
+  Quectel GNSS LC29X Linux Serial Transport
+
+  termios setup:
+  - raw mode (no echo, no line editing, no CR/LF translation), 8N1, no flow
+    control, receiver enabled and modem control lines ignored.
+  - VMIN = 1 / VTIME = 0: a read returns as soon as a single byte is there
+    instead of waiting for an inter-byte timer, and an empty non-blocking read
+    reports EAGAIN (with VMIN = 0 it silently returns 0). The waiting itself
+    is done by epoll.
+
+  The LC29H sends its output as bursts of sentences once per fix, so reads go
+  through a drain loop that keeps reading until the tty reports EAGAIN.
+*/
+
+#define _GNU_SOURCE
+
+#include "qc_lc29_linux_serial.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/serial.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+static speed_t lc29_linux_serial_speed(uint32_t baud_rate) {
+  switch (baud_rate) {
+  case 4800:
+    return B4800;
+  case 9600:
+    return B9600;
+  case 19200:
+    return B19200;
+  case 38400:
+    return B38400;
+  case 57600:
+    return B57600;
+  case 115200:
+    return B115200;
+  case 230400:
+    return B230400;
+  case 460800:
+    return B460800;
+  case 921600:
+    return B921600;
+  default:
+    return B0;
+  }
+}
+
+/*
+  ASYNC_LOW_LATENCY stops the tty layer from batching received bytes. Only
+  real serial drivers implement TIOCSSERIAL, anything else keeps its default.
+*/
+static bool lc29_linux_serial_low_latency(int fd) {
+  struct serial_struct settings;
+
+  if (ioctl(fd, TIOCGSERIAL, &settings) != 0) {
+    return false;
+  }
+  settings.flags |= ASYNC_LOW_LATENCY;
+  return ioctl(fd, TIOCSSERIAL, &settings) == 0;
+}
+
+static qc_lc29x_driver_response_t lc29_linux_serial_configure(int fd,
+                                                              speed_t speed) {
+  struct termios tty;
+
+  if (tcgetattr(fd, &tty) != 0) {
+    return DRIVCER_FAIL;
+  }
+
+  cfmakeraw(&tty);
+  tty.c_cflag |= CLOCAL | CREAD;
+  tty.c_cflag &= ~(CSTOPB | CRTSCTS);
+  tty.c_cc[VMIN] = 1;
+  tty.c_cc[VTIME] = 0;
+  if (cfsetispeed(&tty, speed) != 0 || cfsetospeed(&tty, speed) != 0) {
+    return DRIVCER_FAIL;
+  }
+  if (tcsetattr(fd, TCSANOW, &tty) != 0) {
+    return DRIVCER_FAIL;
+  }
+
+  tcflush(fd, TCIOFLUSH);
+  return DRIVER_SUCCESS;
+}
+
+/*
+  Takes over an already open tty (or the slave side of a pty). The fd stays
+  owned by the caller.
+*/
+qc_lc29x_driver_response_t
+lc29_linux_serial_attach(qc_lc29x_linux_serial_s *serial, int fd,
+                         uint32_t baud_rate) {
+  speed_t speed = lc29_linux_serial_speed(baud_rate);
+
+  serial->fd = -1;
+  serial->epoll_fd = -1;
+  serial->owns_fd = false;
+  serial->low_latency = false;
+
+  if (B0 == speed) {
+    return DRIVCER_FAIL;
+  }
+
+  int flags = fcntl(fd, F_GETFL);
+  if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+    return DRIVCER_FAIL;
+  }
+  if (lc29_linux_serial_configure(fd, speed) != DRIVER_SUCCESS) {
+    return DRIVCER_FAIL;
+  }
+
+  serial->fd = fd;
+  serial->low_latency = lc29_linux_serial_low_latency(fd);
+  return DRIVER_SUCCESS;
+}
+
+qc_lc29x_driver_response_t
+lc29_linux_serial_open(qc_lc29x_linux_serial_s *serial, const char *path,
+                       uint32_t baud_rate) {
+  int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+  if (fd < 0) {
+    serial->fd = -1;
+    serial->epoll_fd = -1;
+    serial->owns_fd = false;
+    return DRIVCER_FAIL;
+  }
+
+  if (lc29_linux_serial_attach(serial, fd, baud_rate) != DRIVER_SUCCESS) {
+    close(fd);
+    return DRIVCER_FAIL;
+  }
+  serial->owns_fd = true;
+  return DRIVER_SUCCESS;
+}
+
+void lc29_linux_serial_close(qc_lc29x_linux_serial_s *serial) {
+  if (serial->epoll_fd >= 0) {
+    close(serial->epoll_fd);
+  }
+  if (serial->owns_fd && serial->fd >= 0) {
+    close(serial->fd);
+  }
+  serial->fd = -1;
+  serial->epoll_fd = -1;
+  serial->owns_fd = false;
+}
+
+/*
+  The epoll instance is only created once something waits on this serial.
+  Fleet members are drained from the fleet's own epoll and never need one,
+  which keeps them at a single fd per module.
+*/
+static int lc29_linux_serial_wait(qc_lc29x_linux_serial_s *serial,
+                                  int timeout_ms) {
+  struct epoll_event event;
+  int ready;
+
+  if (serial->epoll_fd < 0) {
+    event.events = EPOLLIN;
+    event.data.fd = serial->fd;
+    serial->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (serial->epoll_fd < 0) {
+      return -1;
+    }
+    if (epoll_ctl(serial->epoll_fd, EPOLL_CTL_ADD, serial->fd, &event) != 0) {
+      close(serial->epoll_fd);
+      serial->epoll_fd = -1;
+      return -1;
+    }
+  }
+
+  do {
+    ready = epoll_wait(serial->epoll_fd, &event, 1, timeout_ms);
+  } while (ready < 0 && EINTR == errno);
+  return ready;
+}
+
+/*
+  Reads whatever is available, waiting up to timeout_ms for the first byte.
+  Returns 0 on timeout and -1 on error (including a hang-up).
+*/
+static int lc29_linux_serial_read(void *ctx, char *data, size_t length,
+                                  int timeout_ms) {
+  qc_lc29x_linux_serial_s *serial = ctx;
+
+  for (;;) {
+    ssize_t received = read(serial->fd, data, length);
+    if (received > 0) {
+      return (int)received;
+    }
+    // With VMIN = 1 an empty tty reports EAGAIN, end of file is a hang-up
+    if (0 == received) {
+      return -1;
+    }
+    if (EINTR == errno) {
+      continue;
+    }
+    if (EAGAIN != errno && EWOULDBLOCK != errno) {
+      return -1;
+    }
+    if (0 == timeout_ms) {
+      return 0;
+    }
+
+    int ready = lc29_linux_serial_wait(serial, timeout_ms);
+    if (ready <= 0) {
+      return ready;
+    }
+    // Only wait once, the data that woke us up is read on the next pass
+    timeout_ms = 0;
+  }
+}
+
+/*
+  Writes as much as the TX buffer takes, waiting up to timeout_ms for room.
+  Returns 0 when the buffer stayed full.
+*/
+static int lc29_linux_serial_write(void *ctx, const char *data, size_t length,
+                                   int timeout_ms) {
+  qc_lc29x_linux_serial_s *serial = ctx;
+  struct pollfd room = {.fd = serial->fd, .events = POLLOUT};
+
+  for (;;) {
+    ssize_t written = write(serial->fd, data, length);
+    if (written >= 0) {
+      return (int)written;
+    }
+    if (EINTR == errno) {
+      continue;
+    }
+    if (EAGAIN != errno && EWOULDBLOCK != errno) {
+      return -1;
+    }
+    if (0 == timeout_ms) {
+      return 0;
+    }
+
+    int ready = poll(&room, 1, timeout_ms);
+    if (ready < 0 && EINTR == errno) {
+      continue;
+    }
+    if (ready <= 0) {
+      return ready;
+    }
+    timeout_ms = 0;
+  }
+}
+
+const qc_lc29x_transport_s lc29_linux_serial_transport = {
+    .init = NULL,
+    .write = lc29_linux_serial_write,
+    .read = lc29_linux_serial_read,
+    .config = NULL,
+};
+
+/*
+  Feeds everything the tty has buffered into the driver without blocking.
+  Returns the number of bytes drained or -1 on error.
+*/
+int lc29_linux_serial_drain(qc_lc29x_linux_serial_s *serial,
+                            qc_lc29_driver_s *driver) {
+  char chunk[LC29_LINUX_SERIAL_DRAIN_SIZE];
+  int drained = 0;
+
+  for (;;) {
+    int received = lc29_linux_serial_read(serial, chunk, sizeof(chunk), 0);
+    if (received < 0) {
+      return -1;
+    }
+    if (0 == received) {
+      return drained;
+    }
+    lc29_driver_feed(driver, chunk, (size_t)received);
+    drained += received;
+  }
+}
+
+/*
+  One iteration of an epoll driven RX loop: waits up to timeout_ms for the tty
+  to become readable and drains it into the driver.
+*/
+int lc29_linux_serial_poll(qc_lc29x_linux_serial_s *serial,
+                           qc_lc29_driver_s *driver, int timeout_ms) {
+  int ready = lc29_linux_serial_wait(serial, timeout_ms);
+  if (ready <= 0) {
+    return ready;
+  }
+  return lc29_linux_serial_drain(serial, driver);
+}
+
+/*
+  Monotonic millisecond clock for lc29_driver_set_clock().
+*/
+uint32_t lc29_linux_clock_ms(void) {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000u + now.tv_nsec / 1000000);
+}
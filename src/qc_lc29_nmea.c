@@ -0,0 +1,1374 @@
+/*
+  Quectel GNSS LC29X NMEA Output Decoders
+
+  Standard sentences carry a two character talker ID (GP, GL, GA, GB, GQ or GN
+  for a combined solution) in front of the sentence type:
+
+    $GNGGA,092725.000,4717.113210,N,00833.915187,E,1,08,1.01,499.617,M,
+      48.000,M,,*<Checksum><CR><LF>
+
+  Coordinates are sent as ddmm.mmmm / dddmm.mmmm with 4 to 7 minute decimals
+  and altitudes with 1 to 3 decimals depending on PAIR098. The conversion
+  kernels (qc_lc29_fixed.h) are told that digit count up front. Degrees and
+  minutes are split at a fixed position and the minutes, scaled to 1e-7
+  minute, are divided down to 1e-7 degree, which keeps every intermediate
+  inside 32 bits.
+
+  The DR output sentences ($PQTMINS, $PQTMIMU, $PQTMGPS) are proprietary,
+  without talker, and send coordinates as signed decimal degrees (so do
+  $PQTMDRPVA, $PQTMVEHMOT, $PQTMDRCAL and $PQTMSENMSG, which start with a
+  message version):
+
+    $PQTMINS,43275714,2,31.82072069,117.11531216,43.364,-0.011,0.118,0.009,
+      1.363,0.046,15.762*<Checksum><CR><LF>
+*/
+
+#include "qc_lc29_nmea.h"
+#include "qc_lc29_fixed.h"
+#include "qc_lc29_sentence_id.h"
+#include <string.h>
+
+/* ID plus data fields up to the geoid separation unit */
+#define LC29_GGA_MIN_FIELDS 13
+/* ID plus data fields up to the magnetic variation direction (NMEA 2.3) */
+#define LC29_RMC_MIN_FIELDS 12
+/* ID plus data fields up to the km/h unit */
+#define LC29_VTG_MIN_FIELDS 9
+/* ID, message count, message number, satellites in view */
+#define LC29_GSV_HEADER_FIELDS 4
+#define LC29_GSV_FIELDS_PER_SATELLITE 4
+/* ID, selection mode, fix type, 12 satellites, PDOP, HDOP, VDOP */
+#define LC29_GSA_MIN_FIELDS 18
+#define LC29_GSA_SATELLITES 12
+/* ID plus timestamp, solution type, position, velocity and attitude */
+#define LC29_PQTM_INS_FIELDS 12
+/* ID plus timestamp and the six IMU axes, wheel ticks are optional */
+#define LC29_PQTM_IMU_MIN_FIELDS 8
+/* ID plus data fields up to the number of satellites used */
+#define LC29_PQTM_GPS_FIELDS 12
+/* ID, message version, calibration state, navigation type */
+#define LC29_PQTM_DRCAL_FIELDS 4
+/* ID, message version plus data fields up to the heading */
+#define LC29_PQTM_DRPVA_FIELDS 16
+/* ID, message version, timestamp, speed and the six IMU axes */
+#define LC29_PQTM_VEHMOT_FIELDS 10
+/* ID, message version, timestamp, temperature and the six IMU axes */
+#define LC29_PQTM_SENMSG_MIN_FIELDS 10
+/* Only message version 1 of the DR sentences is known */
+#define LC29_PQTM_MESSAGE_VERSION '1'
+
+/* 1 knot = 1852 m/h = 514.444 mm/s, as mm/s per 1e6 knots */
+#define LC29_KNOTS_TO_MM_S 514444u
+
+enum {
+  GGA_TIME = 1,
+  GGA_LATITUDE,
+  GGA_NORTH_SOUTH,
+  GGA_LONGITUDE,
+  GGA_EAST_WEST,
+  GGA_QUALITY,
+  GGA_NUM_SATELLITES,
+  GGA_HDOP,
+  GGA_ALTITUDE,
+  GGA_ALTITUDE_UNIT,
+  GGA_GEOID_SEPARATION
+};
+
+enum {
+  RMC_TIME = 1,
+  RMC_STATUS,
+  RMC_LATITUDE,
+  RMC_NORTH_SOUTH,
+  RMC_LONGITUDE,
+  RMC_EAST_WEST,
+  RMC_SPEED_KNOTS,
+  RMC_COURSE,
+  RMC_DATE,
+  RMC_MAGNETIC_VARIATION,
+  RMC_MAGNETIC_EAST_WEST,
+  RMC_MODE
+};
+
+enum {
+  GSV_NUM_MESSAGES = 1,
+  GSV_MESSAGE_NUMBER,
+  GSV_SATELLITES_IN_VIEW,
+  GSV_FIRST_SATELLITE
+};
+
+enum {
+  GSA_SELECTION_MODE = 1,
+  GSA_FIX_TYPE,
+  GSA_FIRST_SATELLITE,
+  GSA_PDOP = GSA_FIRST_SATELLITE + LC29_GSA_SATELLITES,
+  GSA_HDOP,
+  GSA_VDOP,
+  GSA_SYSTEM_ID
+};
+
+enum {
+  VTG_COURSE_TRUE = 1,
+  VTG_COURSE_TRUE_UNIT,
+  VTG_COURSE_MAGNETIC,
+  VTG_COURSE_MAGNETIC_UNIT,
+  VTG_SPEED_KNOTS,
+  VTG_SPEED_KNOTS_UNIT,
+  VTG_SPEED_KMH,
+  VTG_SPEED_KMH_UNIT,
+  VTG_MODE
+};
+
+enum {
+  INS_TIMESTAMP = 1,
+  INS_SOLUTION_TYPE,
+  INS_LATITUDE,
+  INS_LONGITUDE,
+  INS_HEIGHT,
+  INS_VELOCITY_NORTH,
+  INS_VELOCITY_EAST,
+  INS_VELOCITY_DOWN,
+  INS_ROLL,
+  INS_PITCH,
+  INS_HEADING
+};
+
+enum {
+  IMU_TIMESTAMP = 1,
+  IMU_ACCELERATION_X,
+  IMU_ANGULAR_RATE_X = IMU_ACCELERATION_X + 3,
+  IMU_WHEEL_TICKS = IMU_ANGULAR_RATE_X + 3,
+  IMU_WHEEL_TICK_TIMESTAMP
+};
+
+enum {
+  PQTM_GPS_TIMESTAMP = 1,
+  PQTM_GPS_TIME_OF_WEEK,
+  PQTM_GPS_LATITUDE,
+  PQTM_GPS_LONGITUDE,
+  PQTM_GPS_HEIGHT,
+  PQTM_GPS_SPEED,
+  PQTM_GPS_HEADING,
+  PQTM_GPS_HORIZONTAL_ACCURACY,
+  PQTM_GPS_HDOP,
+  PQTM_GPS_SOLUTION_TYPE,
+  PQTM_GPS_NUM_SATELLITES
+};
+
+enum {
+  DRCAL_VERSION = 1,
+  DRCAL_CALIBRATION_STATE,
+  DRCAL_NAV_TYPE
+};
+
+enum {
+  DRPVA_VERSION = 1,
+  DRPVA_TIMESTAMP,
+  DRPVA_TIME,
+  DRPVA_NAV_TYPE,
+  DRPVA_LATITUDE,
+  DRPVA_LONGITUDE,
+  DRPVA_ALTITUDE,
+  DRPVA_GEOID_SEPARATION,
+  DRPVA_VELOCITY_NORTH,
+  DRPVA_SPEED = DRPVA_VELOCITY_NORTH + 3,
+  DRPVA_ROLL
+};
+
+enum {
+  VEHMOT_VERSION = 1,
+  VEHMOT_TIMESTAMP,
+  VEHMOT_SPEED,
+  VEHMOT_ACCELERATION_X,
+  VEHMOT_ANGULAR_RATE_X = VEHMOT_ACCELERATION_X + 3
+};
+
+enum {
+  SENMSG_VERSION = 1,
+  SENMSG_TIMESTAMP,
+  SENMSG_TEMPERATURE,
+  SENMSG_ACCELERATION_X,
+  SENMSG_ANGULAR_RATE_X = SENMSG_ACCELERATION_X + 3,
+  SENMSG_VEHICLE_SPEED = SENMSG_ANGULAR_RATE_X + 3
+};
+
+/* Minute decimals of latitude/longitude per PAIR098 setting */
+static const uint8_t lc29_nmea_minute_digits[] = {
+    [LAT_LON_4_ALT_1] = 4,
+    [LAT_LON_5_ALT_2] = 5,
+    [LAT_LON_6_ALT_3] = 6,
+    [LAT_LON_7_ALT_3] = 7,
+};
+
+/* Altitude and geoid separation decimals per PAIR098 setting */
+static const uint8_t lc29_nmea_altitude_digits[] = {
+    [LAT_LON_4_ALT_1] = 1,
+    [LAT_LON_5_ALT_2] = 2,
+    [LAT_LON_6_ALT_3] = 3,
+    [LAT_LON_7_ALT_3] = 3,
+};
+
+/* lc29_sentence_field_length() inlined into the decoders */
+static inline const char *
+lc29_nmea_field(const qc_lc29x_sentence_view_s *sentence, uint8_t index,
+                uint8_t *length) {
+  const qc_lc29x_sentence_info_s *info = sentence->info;
+  uint8_t end = (index + 1 < info->num_fields) ? info->fields[index + 1] - 1
+                                               : info->checksum_offset;
+  *length = (uint8_t)(end - info->fields[index]);
+  return &sentence->data[info->fields[index]];
+}
+
+/* hhmmss with any number of second decimals */
+static bool lc29_nmea_time(const char *field, uint8_t length,
+                           uint32_t *time_ms) {
+  uint32_t hours, minutes, seconds;
+  int32_t millis = 0;
+
+  if (length < 6 || !lc29_fixed_digits(field, 2, &hours) ||
+      !lc29_fixed_digits(&field[2], 2, &minutes) ||
+      !lc29_fixed_digits(&field[4], 2, &seconds)) {
+    return false;
+  }
+  if (length > 6 &&
+      ('.' != field[6] ||
+       !lc29_fixed_scaled(&field[6], length - 6, 3, 3, &millis))) {
+    return false;
+  }
+  if (hours > 23 || minutes > 59 || seconds > 60) {
+    return false;
+  }
+
+  *time_ms = ((hours * 60 + minutes) * 60 + seconds) * 1000 + (uint32_t)millis;
+  return true;
+}
+
+/*
+  Latitude, N/S, longitude, E/W starting at field index. An empty latitude
+  means no position, has_position is cleared and true returned.
+*/
+static bool lc29_nmea_position(const qc_lc29x_sentence_view_s *sentence,
+                               uint8_t index, qc_lc29x_dec_accuracy_t precision,
+                               bool *has_position, int32_t *latitude,
+                               int32_t *longitude) {
+  uint8_t length, hemisphere_length;
+  uint8_t minute_digits = (precision <= LAT_LON_7_ALT_3)
+                              ? lc29_nmea_minute_digits[precision]
+                              : lc29_nmea_minute_digits[LAT_LON_6_ALT_3];
+
+  const char *field = lc29_nmea_field(sentence, index, &length);
+  *has_position = length > 0;
+  *latitude = 0;
+  *longitude = 0;
+  if (!*has_position) {
+    return true;
+  }
+
+  const char *north_south =
+      lc29_nmea_field(sentence, index + 1, &hemisphere_length);
+  if (1 != hemisphere_length ||
+      !lc29_fixed_coordinate(field, length, 2, minute_digits, *north_south,
+                            latitude)) {
+    return false;
+  }
+
+  field = lc29_nmea_field(sentence, index + 2, &length);
+  const char *east_west =
+      lc29_nmea_field(sentence, index + 3, &hemisphere_length);
+  return 1 == hemisphere_length &&
+         lc29_fixed_coordinate(field, length, 3, minute_digits, *east_west,
+                              longitude);
+}
+
+/* Non-negative decimal, scaled, that has to fit 16 bits */
+static bool lc29_nmea_scaled_u16(const char *field, uint8_t length,
+                                 uint8_t scale, uint16_t *value) {
+  int32_t scaled;
+  if (!lc29_fixed_scaled(field, length, scale, scale, &scaled) || scaled < 0 ||
+      scaled > UINT16_MAX) {
+    return false;
+  }
+  *value = (uint16_t)scaled;
+  return true;
+}
+
+/* Non-negative decimal, scaled */
+static bool lc29_nmea_scaled_u32(const char *field, uint8_t length,
+                                 uint8_t scale, uint32_t *value) {
+  int32_t scaled;
+  if (!lc29_fixed_scaled(field, length, scale, scale, &scaled) || scaled < 0) {
+    return false;
+  }
+  *value = (uint32_t)scaled;
+  return true;
+}
+
+/*
+  Days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant's
+  days_from_civil), integer only.
+*/
+static int32_t lc29_nmea_days_from_civil(int32_t year, uint32_t month,
+                                         uint32_t day) {
+  year -= month <= 2;
+  int32_t era = year / 400;
+  uint32_t year_of_era = (uint32_t)(year - era * 400);
+  uint32_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 +
+                         day - 1;
+  uint32_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + (int32_t)day_of_era - 719468;
+}
+
+/*
+  ddmmyy to the start of that UTC day. A date that repeats the cached one
+  (every sentence but the first of a day) costs a compare.
+*/
+static bool lc29_nmea_day_start(const char *field, uint8_t length,
+                                qc_lc29x_date_cache_s *cache,
+                                uint64_t *day_start_ns) {
+  uint32_t date, day, month, year;
+
+  if (6 != length || !lc29_fixed_digits(field, 6, &date)) {
+    return false;
+  }
+  if (NULL != cache && cache->date == date) {
+    *day_start_ns = cache->day_start_ns;
+    return true;
+  }
+
+  day = date / 10000;
+  month = date / 100 % 100;
+  year = date % 100;
+  if (day < 1 || day > 31 || month < 1 || month > 12) {
+    return false;
+  }
+  // Two digit years, the receiver did not exist before 2000
+  year += 2000;
+
+  *day_start_ns = (uint64_t)lc29_nmea_days_from_civil((int32_t)year, month,
+                                                      day) *
+                  86400ull * 1000000000ull;
+  if (NULL != cache) {
+    cache->date = date;
+    cache->day_start_ns = *day_start_ns;
+  }
+  return true;
+}
+
+/* One character field, '\0' when empty */
+static bool lc29_nmea_char(const char *field, uint8_t length, char *value) {
+  *value = 1 == length ? field[0] : '\0';
+  return length <= 1;
+}
+
+/*
+  True when the sentence is a standard sentence of the given type, whatever
+  its talker ID, e.g. lc29_nmea_is_type(sentence, "GGA").
+*/
+bool lc29_nmea_is_type(const qc_lc29x_sentence_view_s *sentence,
+                       const char *type) {
+  uint8_t id_length = sentence->info->id_length;
+  return id_length > 2 && strlen(type) == (size_t)(id_length - 2) &&
+         memcmp(&sentence->data[3], type, id_length - 2) == 0;
+}
+
+/* lc29_nmea_is_type() for the three letter standard sentence types */
+static inline bool lc29_nmea_type3(const qc_lc29x_sentence_view_s *sentence,
+                                   const char type[3]) {
+  const char *id = &sentence->data[3];
+  return 5 == sentence->info->id_length && id[0] == type[0] &&
+         id[1] == type[1] && id[2] == type[2];
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_gga(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_dec_accuracy_t precision, qc_lc29x_gga_s *gga) {
+  const char *field;
+  uint8_t length;
+  uint32_t value;
+  uint8_t altitude_digits = (precision <= LAT_LON_7_ALT_3)
+                                ? lc29_nmea_altitude_digits[precision]
+                                : lc29_nmea_altitude_digits[LAT_LON_6_ALT_3];
+
+  if (!lc29_nmea_type3(sentence, "GGA")) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (sentence->info->num_fields < LC29_GGA_MIN_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  field = lc29_nmea_field(sentence, GGA_TIME, &length);
+  gga->has_time = length > 0;
+  gga->utc_time_ms = 0;
+  if (gga->has_time && !lc29_nmea_time(field, length, &gga->utc_time_ms)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  if (!lc29_nmea_position(sentence, GGA_LATITUDE, precision,
+                          &gga->has_position, &gga->latitude,
+                          &gga->longitude)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, GGA_QUALITY, &length);
+  gga->fix_quality = LC29_FIX_INVALID;
+  if (length > 0) {
+    if (1 != length || !lc29_fixed_digits(field, 1, &value)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    gga->fix_quality = (uint8_t)value;
+  }
+
+  field = lc29_nmea_field(sentence, GGA_NUM_SATELLITES, &length);
+  gga->num_satellites = 0;
+  if (length > 0) {
+    if (length > 2 || !lc29_fixed_digits(field, length, &value)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    gga->num_satellites = (uint8_t)value;
+  }
+
+  field = lc29_nmea_field(sentence, GGA_HDOP, &length);
+  gga->hdop = 0;
+  if (length > 0 && !lc29_nmea_scaled_u16(field, length, 2, &gga->hdop)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, GGA_ALTITUDE, &length);
+  gga->has_altitude = length > 0;
+  gga->altitude_mm = 0;
+  gga->geoid_separation_mm = 0;
+  if (gga->has_altitude &&
+      !lc29_fixed_scaled(field, length, altitude_digits, 3,
+                         &gga->altitude_mm)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, GGA_GEOID_SEPARATION, &length);
+  if (length > 0 &&
+      !lc29_fixed_scaled(field, length, altitude_digits, 3,
+                         &gga->geoid_separation_mm)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  return LC29_NMEA_OK;
+}
+
+/* Speed over ground, whole knots up to 999999.999 */
+static bool lc29_nmea_knots(const char *field, uint8_t length,
+                            uint32_t *speed_mm_s) {
+  int32_t milli_knots;
+  if (!lc29_fixed_scaled(field, length, 3, 3, &milli_knots) ||
+      milli_knots < 0) {
+    return false;
+  }
+  *speed_mm_s = (uint32_t)(((uint64_t)milli_knots * LC29_KNOTS_TO_MM_S +
+                            500000u) /
+                           1000000u);
+  return true;
+}
+
+void lc29_nmea_date_cache_init(qc_lc29x_date_cache_s *cache) {
+  cache->date = UINT32_MAX;
+  cache->day_start_ns = 0;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_rmc(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_dec_accuracy_t precision,
+                     qc_lc29x_date_cache_s *cache, qc_lc29x_rmc_s *rmc) {
+  const char *field;
+  uint8_t length;
+  uint64_t day_start_ns = 0;
+
+  if (!lc29_nmea_type3(sentence, "RMC")) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (sentence->info->num_fields < LC29_RMC_MIN_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  field = lc29_nmea_field(sentence, RMC_TIME, &length);
+  rmc->has_time = length > 0;
+  rmc->utc_time_ms = 0;
+  if (rmc->has_time && !lc29_nmea_time(field, length, &rmc->utc_time_ms)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, RMC_STATUS, &length);
+  rmc->valid = 1 == length && 'A' == field[0];
+
+  if (!lc29_nmea_position(sentence, RMC_LATITUDE, precision,
+                          &rmc->has_position, &rmc->latitude,
+                          &rmc->longitude)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, RMC_SPEED_KNOTS, &length);
+  rmc->speed_mm_s = 0;
+  if (length > 0 && !lc29_nmea_knots(field, length, &rmc->speed_mm_s)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, RMC_COURSE, &length);
+  rmc->has_course = length > 0;
+  rmc->course_cdeg = 0;
+  if (rmc->has_course &&
+      !lc29_nmea_scaled_u16(field, length, 2, &rmc->course_cdeg)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, RMC_DATE, &length);
+  rmc->has_date = length > 0;
+  if (rmc->has_date &&
+      !lc29_nmea_day_start(field, length, cache, &day_start_ns)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  rmc->utc_epoch_ns =
+      (rmc->has_date && rmc->has_time)
+          ? day_start_ns + (uint64_t)rmc->utc_time_ms * 1000000u
+          : 0;
+
+  rmc->mode = '\0';
+  if (sentence->info->num_fields > RMC_MODE) {
+    field = lc29_nmea_field(sentence, RMC_MODE, &length);
+    if (!lc29_nmea_char(field, length, &rmc->mode)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  return LC29_NMEA_OK;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_vtg(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_vtg_s *vtg) {
+  const char *field;
+  uint8_t length;
+
+  if (!lc29_nmea_type3(sentence, "VTG")) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (sentence->info->num_fields < LC29_VTG_MIN_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  field = lc29_nmea_field(sentence, VTG_COURSE_TRUE, &length);
+  vtg->has_course = length > 0;
+  vtg->course_cdeg = 0;
+  if (vtg->has_course &&
+      !lc29_nmea_scaled_u16(field, length, 2, &vtg->course_cdeg)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  // km/h carries the finer resolution, knots only when it is missing
+  field = lc29_nmea_field(sentence, VTG_SPEED_KMH, &length);
+  vtg->speed_mm_s = 0;
+  if (length > 0) {
+    int32_t meters_per_hour;
+    if (!lc29_fixed_scaled(field, length, 3, 3, &meters_per_hour) ||
+        meters_per_hour < 0) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    vtg->speed_mm_s = (uint32_t)(((uint64_t)meters_per_hour * 1000u + 1800u) /
+                                 3600u);
+    vtg->has_speed = true;
+  } else {
+    field = lc29_nmea_field(sentence, VTG_SPEED_KNOTS, &length);
+    vtg->has_speed = length > 0;
+    if (vtg->has_speed && !lc29_nmea_knots(field, length, &vtg->speed_mm_s)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  vtg->mode = '\0';
+  if (sentence->info->num_fields > VTG_MODE) {
+    field = lc29_nmea_field(sentence, VTG_MODE, &length);
+    if (!lc29_nmea_char(field, length, &vtg->mode)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  return LC29_NMEA_OK;
+}
+
+/* Constellation from the talker ID, MULTI when unknown */
+static uint8_t lc29_nmea_talker_constellation(const char *talker) {
+  switch (talker[0] << 8 | talker[1]) {
+  case 'G' << 8 | 'P':
+    return GPS;
+  case 'G' << 8 | 'L':
+    return GLONASS;
+  case 'G' << 8 | 'A':
+    return GALILEO;
+  case 'G' << 8 | 'B':
+  case 'B' << 8 | 'D':
+    return BEIDOU;
+  case 'G' << 8 | 'Q':
+  case 'Q' << 8 | 'Z':
+    return QZSS;
+  default:
+    return MULTI;
+  }
+}
+
+/* Unsigned integer field of at most 3 digits, fallback when empty */
+static bool lc29_nmea_small_uint(const char *field, uint8_t length,
+                                 uint32_t fallback, uint32_t *value) {
+  if (0 == length) {
+    *value = fallback;
+    return true;
+  }
+  return length <= 3 && lc29_fixed_digits(field, length, value);
+}
+
+void lc29_nmea_gsv_table_reset(qc_lc29x_gsv_table_s *table) {
+  table->count = 0;
+  table->overflow = 0;
+  for (int i = 0; i < LC29_CONSTELLATION_COUNT; i++) {
+    table->sequences_done[i] = 0;
+  }
+  table->sequence_next = 0;
+}
+
+/* True when no GSV sequence is half way through */
+bool lc29_nmea_gsv_complete(const qc_lc29x_gsv_table_s *table) {
+  return 0 == table->sequence_next && table->count > 0;
+}
+
+/* Drops what was added of the sequence in progress */
+static void lc29_nmea_gsv_abort(qc_lc29x_gsv_table_s *table) {
+  uint8_t kept = 0;
+
+  for (uint8_t i = 0; i < table->count; i++) {
+    if (table->constellation[i] != table->sequence_constellation ||
+        table->signal[i] != table->sequence_signal) {
+      table->prn[kept] = table->prn[i];
+      table->snr[kept] = table->snr[i];
+      table->constellation[kept] = table->constellation[i];
+      table->signal[kept] = table->signal[i];
+      table->elevation[kept] = table->elevation[i];
+      table->azimuth[kept] = table->azimuth[i];
+      kept++;
+    }
+  }
+  table->count = kept;
+  table->sequence_next = 0;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_gsv(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_gsv_table_s *table) {
+  const char *field;
+  uint8_t length;
+  uint32_t total, number;
+  uint8_t signal = 0;
+
+  if (!lc29_nmea_type3(sentence, "GSV")) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  uint8_t num_fields = sentence->info->num_fields;
+  if (num_fields < LC29_GSV_HEADER_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  // NMEA 4.10 appends the signal ID after the satellites
+  uint8_t satellites =
+      (num_fields - LC29_GSV_HEADER_FIELDS) / LC29_GSV_FIELDS_PER_SATELLITE;
+  if ((num_fields - LC29_GSV_HEADER_FIELDS) % LC29_GSV_FIELDS_PER_SATELLITE) {
+    field = lc29_nmea_field(sentence, num_fields - 1, &length);
+    uint8_t digit = (uint8_t)(field[0] - '0');
+    uint8_t letter = (uint8_t)((field[0] | 0x20) - 'a');
+    if (1 != length || (digit > 9 && letter > 5)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    signal = digit <= 9 ? digit : (uint8_t)(letter + 10);
+  }
+
+  field = lc29_nmea_field(sentence, GSV_NUM_MESSAGES, &length);
+  if (!lc29_nmea_small_uint(field, length, 0, &total) || 0 == total) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, GSV_MESSAGE_NUMBER, &length);
+  if (!lc29_nmea_small_uint(field, length, 0, &number) || 0 == number ||
+      number > total) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  uint8_t constellation = lc29_nmea_talker_constellation(&sentence->data[1]);
+  uint16_t signal_bit = (uint16_t)(1u << signal);
+
+  if (1 == number) {
+    if (table->sequence_next != 0) {
+      lc29_nmea_gsv_abort(table);
+    }
+    // This sequence was already in the table, a new epoch has started
+    if (table->sequences_done[constellation] & signal_bit) {
+      lc29_nmea_gsv_table_reset(table);
+    }
+    table->sequence_constellation = constellation;
+    table->sequence_signal = signal;
+    table->sequence_total = (uint8_t)total;
+  } else if (number != table->sequence_next ||
+             total != table->sequence_total ||
+             constellation != table->sequence_constellation ||
+             signal != table->sequence_signal) {
+    if (table->sequence_next != 0) {
+      lc29_nmea_gsv_abort(table);
+    }
+    return LC29_NMEA_OUT_OF_SEQUENCE;
+  }
+
+  for (uint8_t i = 0; i < satellites; i++) {
+    uint8_t index = GSV_FIRST_SATELLITE + i * LC29_GSV_FIELDS_PER_SATELLITE;
+    uint32_t prn, azimuth, snr;
+    int32_t elevation = LC29_GSV_UNKNOWN_ELEVATION;
+
+    field = lc29_nmea_field(sentence, index, &length);
+    if (0 == length) {
+      continue; // padding of a short last sentence
+    }
+    if (!lc29_nmea_small_uint(field, length, 0, &prn) || prn > UINT8_MAX) {
+      lc29_nmea_gsv_abort(table);
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, index + 1, &length);
+    if (length > 0 && (!lc29_fixed_scaled(field, length, 0, 0, &elevation) ||
+                       elevation < -90 || elevation > 90)) {
+      lc29_nmea_gsv_abort(table);
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, index + 2, &length);
+    if (!lc29_nmea_small_uint(field, length, LC29_GSV_UNKNOWN_AZIMUTH,
+                              &azimuth)) {
+      lc29_nmea_gsv_abort(table);
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, index + 3, &length);
+    if (!lc29_nmea_small_uint(field, length, 0, &snr) || snr > UINT8_MAX) {
+      lc29_nmea_gsv_abort(table);
+      return LC29_NMEA_INVALID_FIELD;
+    }
+
+    if (table->count >= LC29_GSV_MAX_SATELLITES) {
+      table->overflow++;
+      continue;
+    }
+    uint8_t slot = table->count++;
+    table->prn[slot] = (uint8_t)prn;
+    table->snr[slot] = (uint8_t)snr;
+    table->constellation[slot] = constellation;
+    table->signal[slot] = signal;
+    table->elevation[slot] = (int8_t)elevation;
+    table->azimuth[slot] = (uint16_t)azimuth;
+  }
+
+  if (number == total) {
+    table->sequences_done[constellation] |= signal_bit;
+    table->sequence_next = 0;
+  } else {
+    table->sequence_next = (uint8_t)(number + 1);
+  }
+  return LC29_NMEA_OK;
+}
+
+/*
+  Per constellation counts and SNR figures of the table. Every constellation
+  is one branch free pass over the snr and constellation arrays.
+*/
+void lc29_nmea_gsv_snr_stats(
+    const qc_lc29x_gsv_table_s *table,
+    qc_lc29x_snr_stats_s stats[LC29_CONSTELLATION_COUNT]) {
+  for (uint8_t c = 0; c < LC29_CONSTELLATION_COUNT; c++) {
+    uint32_t in_view = 0, tracked = 0, sum = 0;
+    uint8_t max = 0;
+
+    for (uint8_t i = 0; i < table->count; i++) {
+      uint8_t match = table->constellation[i] == c;
+      uint8_t snr = match ? table->snr[i] : 0;
+      in_view += match;
+      tracked += snr > 0;
+      sum += snr;
+      max = snr > max ? snr : max;
+    }
+
+    stats[c].in_view = (uint8_t)in_view;
+    stats[c].tracked = (uint8_t)tracked;
+    stats[c].snr_max = max;
+    stats[c].snr_mean = tracked ? (uint8_t)((sum + tracked / 2) / tracked) : 0;
+  }
+}
+
+/*
+  Bit of a satellite in a per system set. NMEA numbers GLONASS 65-96, QZSS
+  193-202 and, on some firmware, BeiDou 201-263; these are folded back to the
+  satellite number within the system so every system fits 64 bits.
+*/
+uint8_t lc29_nmea_satellite_bit(uint8_t constellation, uint8_t prn) {
+  switch (constellation) {
+  case GLONASS:
+    prn = prn > 64 ? (uint8_t)(prn - 64) : prn;
+    break;
+  case QZSS:
+    prn = prn > 192 ? (uint8_t)(prn - 192) : prn;
+    break;
+  case BEIDOU:
+    prn = prn > 200 ? (uint8_t)(prn - 200) : prn;
+    break;
+  default:
+    break;
+  }
+  return prn & 63;
+}
+
+/*
+  Per system set of the satellites in the table with at least min_snr, 0 for
+  every satellite in view. Signals of the same satellite share its bit.
+*/
+void lc29_nmea_gsv_satellite_sets(const qc_lc29x_gsv_table_s *table,
+                                  uint8_t min_snr,
+                                  uint64_t sets[LC29_CONSTELLATION_COUNT]) {
+  for (int c = 0; c < LC29_CONSTELLATION_COUNT; c++) {
+    sets[c] = 0;
+  }
+  for (uint8_t i = 0; i < table->count; i++) {
+    uint8_t constellation = table->constellation[i];
+    uint64_t selected = table->snr[i] >= min_snr;
+    sets[constellation] |=
+        selected << lc29_nmea_satellite_bit(constellation, table->prn[i]);
+  }
+}
+
+/* System from the PRN range when a GN talker sends no system ID */
+static uint8_t lc29_nmea_prn_constellation(uint32_t prn) {
+  if (prn >= 1 && prn <= 32) {
+    return GPS;
+  }
+  if (prn >= 65 && prn <= 96) {
+    return GLONASS;
+  }
+  if (prn >= 193 && prn <= 202) {
+    return QZSS;
+  }
+  return MULTI;
+}
+
+/* NMEA 4.10 system ID to qc_lc29x_constellation_t */
+static const uint8_t lc29_nmea_system_constellation[] = {
+    [1] = GPS, [2] = GLONASS, [3] = GALILEO, [4] = BEIDOU, [5] = QZSS,
+};
+
+void lc29_nmea_gsa_reset(qc_lc29x_gsa_s *gsa) {
+  for (int c = 0; c < LC29_CONSTELLATION_COUNT; c++) {
+    gsa->used[c] = 0;
+  }
+  gsa->pdop = 0;
+  gsa->hdop = 0;
+  gsa->vdop = 0;
+  gsa->fix_type = 1;
+  gsa->selection_mode = '\0';
+  gsa->system_id = 0;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_gsa(const qc_lc29x_sentence_view_s *sentence,
+                     qc_lc29x_gsa_s *gsa) {
+  const char *field;
+  uint8_t length;
+  uint32_t value;
+  uint8_t constellation;
+
+  if (!lc29_nmea_type3(sentence, "GSA")) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (sentence->info->num_fields < LC29_GSA_MIN_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  // The system ID wins over the talker, GN is used for every system
+  constellation = lc29_nmea_talker_constellation(&sentence->data[1]);
+  gsa->system_id = 0;
+  if (sentence->info->num_fields > GSA_SYSTEM_ID) {
+    field = lc29_nmea_field(sentence, GSA_SYSTEM_ID, &length);
+    if (!lc29_nmea_small_uint(field, length, 0, &value)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    gsa->system_id = value > UINT8_MAX ? UINT8_MAX : (uint8_t)value;
+    if (value > 0) {
+      constellation = value < sizeof(lc29_nmea_system_constellation)
+                          ? lc29_nmea_system_constellation[value]
+                          : MULTI;
+    }
+  }
+
+  field = lc29_nmea_field(sentence, GSA_SELECTION_MODE, &length);
+  if (!lc29_nmea_char(field, length, &gsa->selection_mode)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, GSA_FIX_TYPE, &length);
+  if (!lc29_nmea_small_uint(field, length, 1, &value) || value < 1 ||
+      value > 3) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  gsa->fix_type = (uint8_t)value;
+
+  for (uint8_t i = 0; i < LC29_GSA_SATELLITES; i++) {
+    field = lc29_nmea_field(sentence, GSA_FIRST_SATELLITE + i, &length);
+    if (0 == length) {
+      continue;
+    }
+    if (!lc29_nmea_small_uint(field, length, 0, &value) || value > UINT8_MAX) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    uint8_t system = MULTI == constellation
+                         ? lc29_nmea_prn_constellation(value)
+                         : constellation;
+    gsa->used[system] |=
+        1ull << lc29_nmea_satellite_bit(system, (uint8_t)value);
+  }
+
+  // Every GSA of an epoch repeats the DOPs of the combined solution
+  field = lc29_nmea_field(sentence, GSA_PDOP, &length);
+  if (length > 0 && !lc29_nmea_scaled_u16(field, length, 2, &gsa->pdop)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, GSA_HDOP, &length);
+  if (length > 0 && !lc29_nmea_scaled_u16(field, length, 2, &gsa->hdop)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, GSA_VDOP, &length);
+  if (length > 0 && !lc29_nmea_scaled_u16(field, length, 2, &gsa->vdop)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  return LC29_NMEA_OK;
+}
+
+/* Scaled decimal fields at index, index + 1... all empty or all present */
+static bool lc29_nmea_scaled_fields(const qc_lc29x_sentence_view_s *sentence,
+                                    uint8_t index, uint8_t count,
+                                    uint8_t scale, int32_t *values,
+                                    bool *present) {
+  const char *field;
+  uint8_t length;
+
+  field = lc29_nmea_field(sentence, index, &length);
+  *present = length > 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (i > 0) {
+      field = lc29_nmea_field(sentence, index + i, &length);
+    }
+    values[i] = 0;
+    if (*present != (length > 0) ||
+        (*present &&
+         !lc29_fixed_scaled(field, length, scale, scale, &values[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_ins(const qc_lc29x_sentence_view_s *sentence,
+                          qc_lc29x_pqtm_ins_s *ins) {
+  const char *field;
+  uint8_t length;
+  uint32_t value;
+  int32_t attitude[3];
+
+  if (LC29_ID_DR_NAV_RESULTS != sentence->info->id) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (sentence->info->num_fields < LC29_PQTM_INS_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  field = lc29_nmea_field(sentence, INS_TIMESTAMP, &length);
+  if (!lc29_fixed_uint32(field, length, &ins->timestamp_ms)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, INS_SOLUTION_TYPE, &length);
+  if (!lc29_nmea_small_uint(field, length, 0, &value) || value > UINT8_MAX) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  ins->solution_type = (uint8_t)value;
+
+  field = lc29_nmea_field(sentence, INS_LATITUDE, &length);
+  ins->has_position = length > 0;
+  ins->latitude = 0;
+  ins->longitude = 0;
+  ins->height_mm = 0;
+  if (ins->has_position) {
+    if (!lc29_fixed_degrees(field, length, 90, &ins->latitude)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, INS_LONGITUDE, &length);
+    if (!lc29_fixed_degrees(field, length, 180, &ins->longitude)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, INS_HEIGHT, &length);
+    if (length > 0 &&
+        !lc29_fixed_scaled(field, length, 3, 3, &ins->height_mm)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  if (!lc29_nmea_scaled_fields(sentence, INS_VELOCITY_NORTH, 3, 3,
+                               ins->velocity_mm_s, &ins->has_velocity) ||
+      !lc29_nmea_scaled_fields(sentence, INS_ROLL, 3, 3, attitude,
+                               &ins->has_attitude)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  ins->roll_mdeg = attitude[0];
+  ins->pitch_mdeg = attitude[1];
+  ins->heading_mdeg = attitude[2];
+
+  return LC29_NMEA_OK;
+}
+
+/*
+  Sent at up to 100 Hz, every field is converted with a single pass over its
+  digits and nothing else is touched.
+*/
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_imu(const qc_lc29x_sentence_view_s *sentence,
+                          qc_lc29x_pqtm_imu_s *imu) {
+  const char *field;
+  uint8_t length;
+  bool present;
+
+  if (LC29_ID_DR_IMU_DATA != sentence->info->id) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (sentence->info->num_fields < LC29_PQTM_IMU_MIN_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  field = lc29_nmea_field(sentence, IMU_TIMESTAMP, &length);
+  if (!lc29_fixed_uint32(field, length, &imu->timestamp_ms)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  if (!lc29_nmea_scaled_fields(sentence, IMU_ACCELERATION_X, 3, 6,
+                               imu->acceleration_ug, &present) ||
+      !present ||
+      !lc29_nmea_scaled_fields(sentence, IMU_ANGULAR_RATE_X, 3, 6,
+                               imu->angular_rate_udps, &present) ||
+      !present) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  imu->has_wheel_ticks = false;
+  imu->wheel_ticks = 0;
+  imu->wheel_tick_timestamp_ms = 0;
+  if (sentence->info->num_fields > IMU_WHEEL_TICKS) {
+    field = lc29_nmea_field(sentence, IMU_WHEEL_TICKS, &length);
+    imu->has_wheel_ticks = length > 0;
+    if (imu->has_wheel_ticks &&
+        !lc29_fixed_uint32(field, length, &imu->wheel_ticks)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+  if (sentence->info->num_fields > IMU_WHEEL_TICK_TIMESTAMP) {
+    field = lc29_nmea_field(sentence, IMU_WHEEL_TICK_TIMESTAMP, &length);
+    if (length > 0 &&
+        !lc29_fixed_uint32(field, length, &imu->wheel_tick_timestamp_ms)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  return LC29_NMEA_OK;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_gps(const qc_lc29x_sentence_view_s *sentence,
+                          qc_lc29x_pqtm_gps_s *gps) {
+  const char *field;
+  uint8_t length;
+  uint32_t value;
+
+  if (LC29_ID_DR_GNSS_DATA != sentence->info->id) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  if (sentence->info->num_fields < LC29_PQTM_GPS_FIELDS) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+
+  field = lc29_nmea_field(sentence, PQTM_GPS_TIMESTAMP, &length);
+  if (!lc29_fixed_uint32(field, length, &gps->timestamp_ms)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  // Seconds of the week, 604800.000 at most
+  field = lc29_nmea_field(sentence, PQTM_GPS_TIME_OF_WEEK, &length);
+  gps->time_of_week_ms = 0;
+  if (length > 0 &&
+      (!lc29_nmea_scaled_u32(field, length, 3, &gps->time_of_week_ms) ||
+       gps->time_of_week_ms > 604800000u)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, PQTM_GPS_LATITUDE, &length);
+  gps->has_position = length > 0;
+  gps->latitude = 0;
+  gps->longitude = 0;
+  gps->height_mm = 0;
+  if (gps->has_position) {
+    if (!lc29_fixed_degrees(field, length, 90, &gps->latitude)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, PQTM_GPS_LONGITUDE, &length);
+    if (!lc29_fixed_degrees(field, length, 180, &gps->longitude)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, PQTM_GPS_HEIGHT, &length);
+    if (length > 0 &&
+        !lc29_fixed_scaled(field, length, 3, 3, &gps->height_mm)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  field = lc29_nmea_field(sentence, PQTM_GPS_SPEED, &length);
+  gps->speed_mm_s = 0;
+  if (length > 0 && !lc29_nmea_scaled_u32(field, length, 3, &gps->speed_mm_s)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, PQTM_GPS_HEADING, &length);
+  gps->heading_mdeg = 0;
+  if (length > 0 &&
+      !lc29_fixed_scaled(field, length, 3, 3, &gps->heading_mdeg)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, PQTM_GPS_HORIZONTAL_ACCURACY, &length);
+  gps->horizontal_accuracy_mm = 0;
+  if (length > 0 &&
+      !lc29_nmea_scaled_u32(field, length, 3, &gps->horizontal_accuracy_mm)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, PQTM_GPS_HDOP, &length);
+  gps->hdop = 0;
+  if (length > 0 && !lc29_nmea_scaled_u16(field, length, 2, &gps->hdop)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  field = lc29_nmea_field(sentence, PQTM_GPS_SOLUTION_TYPE, &length);
+  if (!lc29_nmea_small_uint(field, length, 0, &value) || value > UINT8_MAX) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  gps->solution_type = (uint8_t)value;
+  field = lc29_nmea_field(sentence, PQTM_GPS_NUM_SATELLITES, &length);
+  if (!lc29_nmea_small_uint(field, length, 0, &value) || value > UINT8_MAX) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  gps->num_satellites = (uint8_t)value;
+
+  return LC29_NMEA_OK;
+}
+
+/* Message version and timestamp, the first two fields of the DR sentences */
+static qc_lc29x_nmea_result_t
+lc29_nmea_pqtm_header(const qc_lc29x_sentence_view_s *sentence,
+                      uint8_t min_fields, uint32_t *timestamp_ms) {
+  const char *field;
+  uint8_t length;
+
+  if (sentence->info->num_fields < min_fields) {
+    return LC29_NMEA_MISSING_FIELDS;
+  }
+  field = lc29_nmea_field(sentence, 1, &length);
+  if (1 != length || LC29_PQTM_MESSAGE_VERSION != field[0]) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  if (NULL != timestamp_ms) {
+    field = lc29_nmea_field(sentence, 2, &length);
+    if (!lc29_fixed_uint32(field, length, timestamp_ms)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+  return LC29_NMEA_OK;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_drcal(const qc_lc29x_sentence_view_s *sentence,
+                            qc_lc29x_pqtm_drcal_s *drcal) {
+  const char *field;
+  uint8_t length;
+  uint32_t value;
+  qc_lc29x_nmea_result_t result;
+
+  if (LC29_ID_DR_CALIBRATION != sentence->info->id) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  result = lc29_nmea_pqtm_header(sentence, LC29_PQTM_DRCAL_FIELDS, NULL);
+  if (LC29_NMEA_OK != result) {
+    return result;
+  }
+
+  field = lc29_nmea_field(sentence, DRCAL_CALIBRATION_STATE, &length);
+  if (1 != length || !lc29_fixed_digits(field, 1, &value) ||
+      value > LC29_DR_FULLY_CALIBRATED) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  drcal->calibration_state = (uint8_t)value;
+  field = lc29_nmea_field(sentence, DRCAL_NAV_TYPE, &length);
+  if (1 != length || !lc29_fixed_digits(field, 1, &value) ||
+      value > LC29_DR_NAV_COMBINATION) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  drcal->nav_type = (uint8_t)value;
+
+  return LC29_NMEA_OK;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_drpva(const qc_lc29x_sentence_view_s *sentence,
+                            qc_lc29x_pqtm_drpva_s *drpva) {
+  const char *field;
+  uint8_t length;
+  uint32_t value;
+  int32_t attitude[3];
+  qc_lc29x_nmea_result_t result;
+
+  if (LC29_ID_DR_POSITION_VELOCITY_ALTITUDE != sentence->info->id) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  result = lc29_nmea_pqtm_header(sentence, LC29_PQTM_DRPVA_FIELDS,
+                                 &drpva->timestamp_ms);
+  if (LC29_NMEA_OK != result) {
+    return result;
+  }
+
+  field = lc29_nmea_field(sentence, DRPVA_TIME, &length);
+  drpva->has_time = length > 0;
+  drpva->utc_time_ms = 0;
+  if (drpva->has_time && !lc29_nmea_time(field, length, &drpva->utc_time_ms)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, DRPVA_NAV_TYPE, &length);
+  if (!lc29_nmea_small_uint(field, length, LC29_DR_NAV_NO_POSITION, &value) ||
+      value > LC29_DR_NAV_COMBINATION) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  drpva->nav_type = (uint8_t)value;
+
+  field = lc29_nmea_field(sentence, DRPVA_LATITUDE, &length);
+  drpva->has_position = length > 0;
+  drpva->latitude = 0;
+  drpva->longitude = 0;
+  drpva->altitude_mm = 0;
+  drpva->geoid_separation_mm = 0;
+  if (drpva->has_position) {
+    if (!lc29_fixed_degrees(field, length, 90, &drpva->latitude)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, DRPVA_LONGITUDE, &length);
+    if (!lc29_fixed_degrees(field, length, 180, &drpva->longitude)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, DRPVA_ALTITUDE, &length);
+    if (length > 0 &&
+        !lc29_fixed_scaled(field, length, 3, 3, &drpva->altitude_mm)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+    field = lc29_nmea_field(sentence, DRPVA_GEOID_SEPARATION, &length);
+    if (length > 0 &&
+        !lc29_fixed_scaled(field, length, 3, 3, &drpva->geoid_separation_mm)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  if (!lc29_nmea_scaled_fields(sentence, DRPVA_VELOCITY_NORTH, 3, 3,
+                               drpva->velocity_mm_s, &drpva->has_velocity)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  field = lc29_nmea_field(sentence, DRPVA_SPEED, &length);
+  drpva->speed_mm_s = 0;
+  if (length > 0 &&
+      !lc29_nmea_scaled_u32(field, length, 3, &drpva->speed_mm_s)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  if (!lc29_nmea_scaled_fields(sentence, DRPVA_ROLL, 3, 3, attitude,
+                               &drpva->has_attitude)) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  drpva->roll_mdeg = attitude[0];
+  drpva->pitch_mdeg = attitude[1];
+  drpva->heading_mdeg = attitude[2];
+
+  return LC29_NMEA_OK;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_vehmot(const qc_lc29x_sentence_view_s *sentence,
+                             qc_lc29x_pqtm_vehmot_s *vehmot) {
+  const char *field;
+  uint8_t length;
+  bool present;
+  qc_lc29x_nmea_result_t result;
+
+  if (LC29_ID_DR_MOTION_OUTPUT_AFTER_CALIBRATION != sentence->info->id) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  result = lc29_nmea_pqtm_header(sentence, LC29_PQTM_VEHMOT_FIELDS,
+                                 &vehmot->timestamp_ms);
+  if (LC29_NMEA_OK != result) {
+    return result;
+  }
+
+  field = lc29_nmea_field(sentence, VEHMOT_SPEED, &length);
+  if (!lc29_fixed_scaled(field, length, 3, 3, &vehmot->speed_mm_s) ||
+      !lc29_nmea_scaled_fields(sentence, VEHMOT_ACCELERATION_X, 3, 6,
+                               vehmot->acceleration_ug, &present) ||
+      !present ||
+      !lc29_nmea_scaled_fields(sentence, VEHMOT_ANGULAR_RATE_X, 3, 6,
+                               vehmot->angular_rate_udps, &present) ||
+      !present) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  return LC29_NMEA_OK;
+}
+
+qc_lc29x_nmea_result_t
+lc29_nmea_decode_pqtm_senmsg(const qc_lc29x_sentence_view_s *sentence,
+                             qc_lc29x_pqtm_senmsg_s *senmsg) {
+  const char *field;
+  uint8_t length;
+  int32_t temperature;
+  bool present;
+  qc_lc29x_nmea_result_t result;
+
+  if (LC29_ID_DR_SENSOR_OUTPUT != sentence->info->id) {
+    return LC29_NMEA_WRONG_SENTENCE;
+  }
+  result = lc29_nmea_pqtm_header(sentence, LC29_PQTM_SENMSG_MIN_FIELDS,
+                                 &senmsg->timestamp_ms);
+  if (LC29_NMEA_OK != result) {
+    return result;
+  }
+
+  field = lc29_nmea_field(sentence, SENMSG_TEMPERATURE, &length);
+  if (!lc29_fixed_scaled(field, length, 2, 2, &temperature) ||
+      temperature < INT16_MIN || temperature > INT16_MAX) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+  senmsg->imu_temperature_cdeg_c = (int16_t)temperature;
+  if (!lc29_nmea_scaled_fields(sentence, SENMSG_ACCELERATION_X, 3, 6,
+                               senmsg->acceleration_ug, &present) ||
+      !present ||
+      !lc29_nmea_scaled_fields(sentence, SENMSG_ANGULAR_RATE_X, 3, 6,
+                               senmsg->angular_rate_udps, &present) ||
+      !present) {
+    return LC29_NMEA_INVALID_FIELD;
+  }
+
+  senmsg->has_vehicle_speed = false;
+  senmsg->vehicle_speed_mm_s = 0;
+  if (sentence->info->num_fields > SENMSG_VEHICLE_SPEED) {
+    field = lc29_nmea_field(sentence, SENMSG_VEHICLE_SPEED, &length);
+    senmsg->has_vehicle_speed = length > 0;
+    if (senmsg->has_vehicle_speed &&
+        !lc29_nmea_scaled_u32(field, length, 3, &senmsg->vehicle_speed_mm_s)) {
+      return LC29_NMEA_INVALID_FIELD;
+    }
+  }
+
+  return LC29_NMEA_OK;
+}
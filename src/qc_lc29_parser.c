@@ -0,0 +1,294 @@
+/*
+  Quectel GNSS LC29X Incremental Sentence Parser
+
+  All sentences share the NMEA 0183 framing:
+
+    $<ID>,<Field>,...,<Field>*<Checksum><CR><LF>
+
+  <Checksum> is the XOR of every char between '$' and '*', written as two hex
+  digits. The state machine walks the sentence exactly once, going through
+  ID -> BODY -> CHECKSUM_HI -> CHECKSUM_LO -> LINE_END. Receiving the '\n' in
+  LINE_END completes the sentence and the running checksum is compared against
+  the received one.
+*/
+
+#include "qc_lc29_parser.h"
+#include "qc_lc29_fixed.h"
+#include "qc_lc29_sentence_id.h"
+#include <string.h>
+
+#define PAIR_ACK_ID "PAIR001"
+
+static int8_t lc29_parser_hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return (int8_t)(c - '0');
+  }
+  if (c >= 'A' && c <= 'F') {
+    return (int8_t)(c - 'A' + 10);
+  }
+  if (c >= 'a' && c <= 'f') {
+    return (int8_t)(c - 'a' + 10);
+  }
+  return -1;
+}
+
+static qc_lc29x_parse_result_t lc29_parser_fail(qc_lc29x_parser_s *parser,
+                                                qc_lc29x_parse_result_t error) {
+  parser->state = LC29_PARSER_IDLE;
+  return error;
+}
+
+void lc29_parser_init(qc_lc29x_parser_s *parser) {
+  parser->state = LC29_PARSER_IDLE;
+  parser->length = 0;
+  parser->info.num_fields = 0;
+  parser->info.id_length = 0;
+  parser->info.id = LC29_ID_UNKNOWN;
+  parser->info.checksum_offset = 0;
+  parser->info.checksum = 0;
+  parser->info.expected_checksum = 0;
+}
+
+qc_lc29x_parse_result_t lc29_parser_feed(qc_lc29x_parser_s *parser, char c) {
+  qc_lc29x_sentence_info_s *info = &parser->info;
+  int8_t hex;
+
+  // A start char always begins a new sentence, whatever came before it
+  if ('$' == c) {
+    parser->state = LC29_PARSER_ID;
+    parser->length = 1;
+    info->num_fields = 1;
+    info->fields[0] = 1;
+    info->id_length = 0;
+    info->checksum = 0;
+    return LC29_PARSE_IN_PROGRESS;
+  }
+
+  if (LC29_PARSER_IDLE == parser->state) {
+    return LC29_PARSE_IN_PROGRESS;
+  }
+
+  uint16_t offset = parser->length++;
+  if (parser->length > LC29_SENTENCE_MAX_LENGTH) {
+    return lc29_parser_fail(parser, LC29_PARSE_MALFORMED);
+  }
+
+  switch (parser->state) {
+  case LC29_PARSER_ID:
+  case LC29_PARSER_BODY:
+    if (',' != c && '*' != c && '\r' != c && '\n' != c) {
+      info->checksum ^= (uint8_t)c;
+      return LC29_PARSE_IN_PROGRESS;
+    }
+    if (LC29_PARSER_ID == parser->state) {
+      info->id_length = (uint8_t)(offset - 1);
+      parser->state = LC29_PARSER_BODY;
+    }
+    if (',' == c) {
+      if (LC29_SENTENCE_MAX_FIELDS == info->num_fields) {
+        return lc29_parser_fail(parser, LC29_PARSE_MALFORMED);
+      }
+      info->checksum ^= (uint8_t)c;
+      info->fields[info->num_fields++] = (uint8_t)(offset + 1);
+      return LC29_PARSE_IN_PROGRESS;
+    }
+    if ('*' == c) {
+      info->checksum_offset = (uint8_t)offset;
+      parser->state = LC29_PARSER_CHECKSUM_HI;
+      return LC29_PARSE_IN_PROGRESS;
+    }
+    // Line ended before any checksum showed up
+    return lc29_parser_fail(parser, LC29_PARSE_NO_CHECKSUM);
+
+  case LC29_PARSER_CHECKSUM_HI:
+    hex = lc29_parser_hex_value(c);
+    if (hex < 0) {
+      return lc29_parser_fail(parser, LC29_PARSE_MALFORMED);
+    }
+    info->expected_checksum = (uint8_t)(hex << 4);
+    parser->state = LC29_PARSER_CHECKSUM_LO;
+    return LC29_PARSE_IN_PROGRESS;
+
+  case LC29_PARSER_CHECKSUM_LO:
+    hex = lc29_parser_hex_value(c);
+    if (hex < 0) {
+      return lc29_parser_fail(parser, LC29_PARSE_MALFORMED);
+    }
+    info->expected_checksum |= (uint8_t)hex;
+    parser->state = LC29_PARSER_LINE_END;
+    return LC29_PARSE_IN_PROGRESS;
+
+  case LC29_PARSER_LINE_END:
+    if ('\r' == c) {
+      return LC29_PARSE_IN_PROGRESS;
+    }
+    if ('\n' == c) {
+      return lc29_parser_finish(parser);
+    }
+    return lc29_parser_fail(parser, LC29_PARSE_MALFORMED);
+
+  default:
+    return lc29_parser_fail(parser, LC29_PARSE_MALFORMED);
+  }
+}
+
+/*
+  Completes the sentence as if the '\n' had been received. Used when the caller
+  knows the line is over, e.g. a buffer that stops right after the <CR>.
+*/
+qc_lc29x_parse_result_t lc29_parser_finish(qc_lc29x_parser_s *parser) {
+  switch (parser->state) {
+  case LC29_PARSER_LINE_END:
+    parser->state = LC29_PARSER_IDLE;
+    if (parser->info.checksum != parser->info.expected_checksum) {
+      return LC29_PARSE_INVALID_CHECKSUM;
+    }
+    return LC29_PARSE_SENTENCE_OK;
+  case LC29_PARSER_ID:
+  case LC29_PARSER_BODY:
+    return lc29_parser_fail(parser, LC29_PARSE_NO_CHECKSUM);
+  default:
+    return lc29_parser_fail(parser, LC29_PARSE_MALFORMED);
+  }
+}
+
+/*
+  Runs the parser over a buffer that holds a single sentence. A buffer that
+  runs out right after the <CR> is treated as a complete line. Returns
+  LC29_PARSE_IN_PROGRESS if the sentence is not terminated.
+*/
+qc_lc29x_parse_result_t lc29_parser_parse(qc_lc29x_parser_s *parser,
+                                          const char *sentence,
+                                          size_t length) {
+  qc_lc29x_parse_result_t result = LC29_PARSE_IN_PROGRESS;
+
+  lc29_parser_init(parser);
+  for (size_t i = 0; i < length && LC29_PARSE_IN_PROGRESS == result; i++) {
+    result = lc29_parser_feed(parser, sentence[i]);
+  }
+
+  if (LC29_PARSE_IN_PROGRESS == result && length > 0 &&
+      '\r' == sentence[length - 1]) {
+    result = lc29_parser_finish(parser);
+  }
+  if (LC29_PARSE_SENTENCE_OK == result) {
+    parser->info.id = lc29_sentence_id(sentence, &parser->info);
+  }
+
+  return result;
+}
+
+/*
+  Compares the identifier of a parsed sentence against a header such as
+  PAIR_ACK ("$PAIR001"). The full identifier has to match, "$PAIR601" does not
+  match a "$PAIR6010" sentence.
+*/
+bool lc29_sentence_id_equals(const char *sentence,
+                             const qc_lc29x_sentence_info_s *info,
+                             const char *header) {
+  if ('$' == *header) {
+    header++;
+  }
+  return strlen(header) == info->id_length &&
+         memcmp(&sentence[1], header, info->id_length) == 0;
+}
+
+qc_lc29x_sentence_class_t
+lc29_sentence_classify(const char *sentence,
+                       const qc_lc29x_sentence_info_s *info) {
+  const char *id = &sentence[1];
+  uint8_t id_length = info->id_length;
+
+  if (id_length >= 4 && memcmp(id, "PAIR", 4) == 0) {
+    return lc29_sentence_id_equals(sentence, info, PAIR_ACK_ID)
+               ? LC29_SENTENCE_PAIR_ACK
+               : LC29_SENTENCE_PAIR_RESPONSE;
+  }
+
+  if (id_length < 4 || memcmp(id, "PQTM", 4) != 0) {
+    return LC29_SENTENCE_NMEA;
+  }
+
+  // PQTM command replies, everything else is module output
+  if ((id_length >= 6 && memcmp(&id[id_length - 2], "OK", 2) == 0) ||
+      (id_length >= 9 && memcmp(&id[id_length - 5], "ERROR", 5) == 0) ||
+      (id_length >= 7 && memcmp(id, "PQTMCFG", 7) == 0) ||
+      lc29_sentence_id_equals(sentence, info, "PQTMEINSMSG")) {
+    return LC29_SENTENCE_PQTM_RESPONSE;
+  }
+  return LC29_SENTENCE_PQTM;
+}
+
+uint8_t lc29_sentence_field_length(const qc_lc29x_sentence_info_s *info,
+                                   uint8_t index) {
+  if (index >= info->num_fields) {
+    return 0;
+  }
+  uint8_t end = (index + 1 < info->num_fields) ? info->fields[index + 1] - 1
+                                               : info->checksum_offset;
+  return (uint8_t)(end - info->fields[index]);
+}
+
+const char *lc29_sentence_field(const char *sentence,
+                                const qc_lc29x_sentence_info_s *info,
+                                uint8_t index, uint8_t *length) {
+  if (index >= info->num_fields) {
+    *length = 0;
+    return NULL;
+  }
+  *length = lc29_sentence_field_length(info, index);
+  return &sentence[info->fields[index]];
+}
+
+bool lc29_sentence_field_int(const char *sentence,
+                             const qc_lc29x_sentence_info_s *info,
+                             uint8_t index, int32_t *value) {
+  uint8_t length;
+  const char *field = lc29_sentence_field(sentence, info, index, &length);
+  return NULL != field && lc29_fixed_int32(field, length, value);
+}
+
+bool lc29_sentence_field_decimal(const char *sentence,
+                                 const qc_lc29x_sentence_info_s *info,
+                                 uint8_t index, uint8_t scale,
+                                 int32_t *value) {
+  uint8_t length;
+  const char *field = lc29_sentence_field(sentence, info, index, &length);
+  // Fields are expected with scale decimals, any other count converts too
+  return NULL != field && scale <= 9 &&
+         lc29_fixed_scaled(field, length, scale, scale, value);
+}
+
+bool lc29_sentence_field_hex(const char *sentence,
+                             const qc_lc29x_sentence_info_s *info,
+                             uint8_t index, uint32_t *value) {
+  uint8_t length;
+  const char *field = lc29_sentence_field(sentence, info, index, &length);
+  uint32_t result = 0;
+
+  if (NULL == field || 0 == length || length > 8) {
+    return false;
+  }
+  for (uint8_t i = 0; i < length; i++) {
+    int8_t hex = lc29_parser_hex_value(field[i]);
+    if (hex < 0) {
+      return false;
+    }
+    result = result << 4 | (uint8_t)hex;
+  }
+  *value = result;
+  return true;
+}
+
+bool lc29_sentence_field_char(const char *sentence,
+                              const qc_lc29x_sentence_info_s *info,
+                              uint8_t index, char *value) {
+  uint8_t length;
+  const char *field = lc29_sentence_field(sentence, info, index, &length);
+
+  if (NULL == field || length > 1) {
+    return false;
+  }
+  *value = 1 == length ? field[0] : '\0';
+  return true;
+}
@@ -0,0 +1,314 @@
+/*
+  Quectel GNSS LC29X Bulk Sentence Scanner
+
+  The buffer is walked in 64 byte blocks. Each block is compared against
+  '$', '*' and '\n' at once and the hits collected in a 64 bit mask, so the
+  loop only stops on structural characters; everything in between is never
+  looked at byte by byte. Once a frame is complete its checksum is XOR'ed a
+  vector at a time.
+
+  The SIMD kernels are compiled with target attributes, the library itself
+  needs no -msse2/-mavx2 and runs on any x86 CPU (or any other architecture,
+  with the scalar kernels only).
+*/
+
+#include "qc_lc29_scan.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LC29_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+#define LC29_SCAN_BLOCK 64
+
+typedef struct {
+  qc_lc29x_scan_kernel_t kernel;
+  // Bit n set when block[n] is '$', '*' or '\n'
+  uint64_t (*structural)(const char *block);
+  uint8_t (*checksum)(const char *data, size_t length);
+} qc_lc29x_scan_kernels_s;
+
+static uint8_t lc29_scan_fold64(uint64_t value) {
+  value ^= value >> 32;
+  value ^= value >> 16;
+  value ^= value >> 8;
+  return (uint8_t)value;
+}
+
+static uint8_t lc29_scan_checksum_scalar(const char *data, size_t length) {
+  uint64_t accumulator = 0;
+  uint8_t tail = 0;
+
+  for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    accumulator ^= word;
+    data += sizeof(word);
+  }
+  while (length-- > 0) {
+    tail ^= (uint8_t)*data++;
+  }
+  return lc29_scan_fold64(accumulator) ^ tail;
+}
+
+#define LC29_SCAN_ONES 0x0101010101010101ull
+#define LC29_SCAN_LOW7 0x7f7f7f7f7f7f7f7full
+
+// High bit of every byte of word equal to c, exact (no borrow false hits)
+static uint64_t lc29_scan_match_bytes(uint64_t word, char c) {
+  uint64_t x = word ^ (LC29_SCAN_ONES * (uint8_t)c);
+  return ~(((x & LC29_SCAN_LOW7) + LC29_SCAN_LOW7) | x | LC29_SCAN_LOW7);
+}
+
+static uint64_t lc29_scan_structural_scalar(const char *block) {
+  uint64_t mask = 0;
+
+  // Eight bytes at a time; the multiply gathers the byte high bits into one
+  for (int i = 0; i < LC29_SCAN_BLOCK; i += (int)sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, &block[i], sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word); // block[i] in the low byte
+#endif
+    uint64_t hits = lc29_scan_match_bytes(word, '$') |
+                    lc29_scan_match_bytes(word, '*') |
+                    lc29_scan_match_bytes(word, '\n');
+    if (hits != 0) {
+      mask |= (((hits >> 7) * 0x0102040810204080ull) >> 56) << i;
+    }
+  }
+  return mask;
+}
+
+#ifdef LC29_SCAN_X86
+__attribute__((target("sse2"))) static uint8_t
+lc29_scan_fold128(__m128i value) {
+  value = _mm_xor_si128(value, _mm_srli_si128(value, 8));
+  value = _mm_xor_si128(value, _mm_srli_si128(value, 4));
+  value = _mm_xor_si128(value, _mm_srli_si128(value, 2));
+  value = _mm_xor_si128(value, _mm_srli_si128(value, 1));
+  return (uint8_t)_mm_cvtsi128_si32(value);
+}
+
+__attribute__((target("sse2"))) static uint8_t
+lc29_scan_checksum_sse2(const char *data, size_t length) {
+  __m128i accumulator = _mm_setzero_si128();
+
+  for (; length >= 16; length -= 16) {
+    accumulator = _mm_xor_si128(accumulator,
+                                _mm_loadu_si128((const __m128i *)data));
+    data += 16;
+  }
+  return lc29_scan_fold128(accumulator) ^
+         lc29_scan_checksum_scalar(data, length);
+}
+
+__attribute__((target("sse2"))) static uint64_t
+lc29_scan_structural_sse2(const char *block) {
+  const __m128i dollar = _mm_set1_epi8('$');
+  const __m128i star = _mm_set1_epi8('*');
+  const __m128i newline = _mm_set1_epi8('\n');
+  uint64_t mask = 0;
+
+  for (int i = 0; i < LC29_SCAN_BLOCK; i += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)&block[i]);
+    __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, dollar),
+                                             _mm_cmpeq_epi8(chunk, star)),
+                                _mm_cmpeq_epi8(chunk, newline));
+    mask |= (uint64_t)(uint16_t)_mm_movemask_epi8(hits) << i;
+  }
+  return mask;
+}
+
+__attribute__((target("avx2"))) static uint8_t
+lc29_scan_checksum_avx2(const char *data, size_t length) {
+  __m256i accumulator = _mm256_setzero_si256();
+
+  for (; length >= 32; length -= 32) {
+    accumulator = _mm256_xor_si256(accumulator,
+                                   _mm256_loadu_si256((const __m256i *)data));
+    data += 32;
+  }
+  __m128i folded = _mm_xor_si128(_mm256_castsi256_si128(accumulator),
+                                 _mm256_extracti128_si256(accumulator, 1));
+  if (length >= 16) {
+    folded = _mm_xor_si128(folded, _mm_loadu_si128((const __m128i *)data));
+    data += 16;
+    length -= 16;
+  }
+  return lc29_scan_fold128(folded) ^ lc29_scan_checksum_scalar(data, length);
+}
+
+__attribute__((target("avx2"))) static uint64_t
+lc29_scan_structural_avx2(const char *block) {
+  const __m256i dollar = _mm256_set1_epi8('$');
+  const __m256i star = _mm256_set1_epi8('*');
+  const __m256i newline = _mm256_set1_epi8('\n');
+  uint64_t mask = 0;
+
+  for (int i = 0; i < LC29_SCAN_BLOCK; i += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)&block[i]);
+    __m256i hits = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, dollar),
+                        _mm256_cmpeq_epi8(chunk, star)),
+        _mm256_cmpeq_epi8(chunk, newline));
+    mask |= (uint64_t)(uint32_t)_mm256_movemask_epi8(hits) << i;
+  }
+  return mask;
+}
+#endif
+
+static const qc_lc29x_scan_kernels_s lc29_scan_kernels[] = {
+    {LC29_SCAN_SCALAR, lc29_scan_structural_scalar, lc29_scan_checksum_scalar},
+#ifdef LC29_SCAN_X86
+    {LC29_SCAN_SSE2, lc29_scan_structural_sse2, lc29_scan_checksum_sse2},
+    {LC29_SCAN_AVX2, lc29_scan_structural_avx2, lc29_scan_checksum_avx2},
+#endif
+};
+#define LC29_SCAN_KERNEL_COUNT                                                 \
+  (sizeof(lc29_scan_kernels) / sizeof(lc29_scan_kernels[0]))
+
+/*
+  NULL until the first scan. Atomic so threads making their first scan at the
+  same time may race to select it; they all store the same entry of the
+  constant table.
+*/
+static _Atomic(const qc_lc29x_scan_kernels_s *) lc29_scan_active;
+
+static bool lc29_scan_supported(qc_lc29x_scan_kernel_t kernel) {
+  switch (kernel) {
+  case LC29_SCAN_SCALAR:
+    return true;
+#ifdef LC29_SCAN_X86
+  case LC29_SCAN_SSE2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+  case LC29_SCAN_AVX2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+  default:
+    return false;
+  }
+}
+
+static const qc_lc29x_scan_kernels_s *lc29_scan_kernels_get(void) {
+  const qc_lc29x_scan_kernels_s *active =
+      atomic_load_explicit(&lc29_scan_active, memory_order_acquire);
+  if (NULL == active) {
+    lc29_scan_use_kernel(LC29_SCAN_AUTO);
+    active = atomic_load_explicit(&lc29_scan_active, memory_order_acquire);
+  }
+  return active;
+}
+
+bool lc29_scan_use_kernel(qc_lc29x_scan_kernel_t kernel) {
+  // The table is ordered by preference, the last supported one wins
+  for (size_t i = LC29_SCAN_KERNEL_COUNT; i-- > 0;) {
+    const qc_lc29x_scan_kernels_s *candidate = &lc29_scan_kernels[i];
+    if ((LC29_SCAN_AUTO == kernel || candidate->kernel == kernel) &&
+        lc29_scan_supported(candidate->kernel)) {
+      atomic_store_explicit(&lc29_scan_active, candidate,
+                            memory_order_release);
+      return true;
+    }
+  }
+  return false;
+}
+
+qc_lc29x_scan_kernel_t lc29_scan_kernel(void) {
+  return lc29_scan_kernels_get()->kernel;
+}
+
+uint8_t lc29_scan_checksum(const char *data, size_t length) {
+  return lc29_scan_kernels_get()->checksum(data, length);
+}
+
+static int8_t lc29_scan_hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return (int8_t)(c - '0');
+  }
+  if (c >= 'A' && c <= 'F') {
+    return (int8_t)(c - 'A' + 10);
+  }
+  if (c >= 'a' && c <= 'f') {
+    return (int8_t)(c - 'a' + 10);
+  }
+  return -1;
+}
+
+/* Frame from start ('$') to newline ('\n'), star is the first '*' or 0 */
+static void lc29_scan_entry(const qc_lc29x_scan_kernels_s *kernels,
+                            const char *data, size_t start, size_t star,
+                            size_t newline, qc_lc29x_scan_entry_s *entry) {
+  size_t line_end = ('\r' == data[newline - 1]) ? newline - 1 : newline;
+  size_t end = star ? star : line_end;
+
+  entry->start = start;
+  entry->length = (uint16_t)(newline - start + 1);
+  entry->checksum = kernels->checksum(&data[start + 1], end - start - 1);
+  entry->valid = false;
+  if (star && line_end == star + 3) {
+    int8_t high = lc29_scan_hex_value(data[star + 1]);
+    int8_t low = lc29_scan_hex_value(data[star + 2]);
+    entry->valid = high >= 0 && low >= 0 &&
+                   entry->checksum == (uint8_t)(high << 4 | low);
+  }
+}
+
+size_t lc29_scan_sentences(const char *data, size_t length,
+                           qc_lc29x_scan_entry_s *entries, size_t max_entries,
+                           size_t *consumed) {
+  const qc_lc29x_scan_kernels_s *kernels = lc29_scan_kernels_get();
+  char last_block[LC29_SCAN_BLOCK];
+  size_t count = 0;
+  size_t start = SIZE_MAX; // '$' of the frame in progress
+  size_t star = 0;
+
+  for (size_t base = 0; base < length; base += LC29_SCAN_BLOCK) {
+    uint64_t mask;
+    if (length - base >= LC29_SCAN_BLOCK) {
+      mask = kernels->structural(&data[base]);
+    } else {
+      // Never read past the buffer, the padding matches nothing
+      memset(last_block, 0, sizeof(last_block));
+      memcpy(last_block, &data[base], length - base);
+      mask = kernels->structural(last_block);
+    }
+
+    for (; mask != 0; mask &= mask - 1) {
+      size_t position = base + (size_t)__builtin_ctzll(mask);
+      switch (data[position]) {
+      case '$':
+        // A new start char drops a frame that never ended, as the framer does
+        start = position;
+        star = 0;
+        break;
+      case '*':
+        if (SIZE_MAX != start && 0 == star) {
+          star = position;
+        }
+        break;
+      default: // '\n'
+        if (SIZE_MAX == start) {
+          break;
+        }
+        if (position - start + 1 <= LC29_SENTENCE_MAX_LENGTH) {
+          if (count == max_entries) {
+            *consumed = start;
+            return count;
+          }
+          lc29_scan_entry(kernels, data, start, star, position,
+                          &entries[count++]);
+        }
+        start = SIZE_MAX;
+        break;
+      }
+    }
+  }
+
+  *consumed = (SIZE_MAX != start) ? start : length;
+  return count;
+}
@@ -0,0 +1,88 @@
+/*
+  Quectel GNSS LC29X Sentence Identifiers
+
+  Perfect hash over the identifiers listed in LC29_SENTENCE_IDS(). Headers
+  and lengths are constant tables; the slot of every identifier is computed
+  by the hash function itself on the first lookup, so a slot can never be
+  out of step with the hash.
+*/
+
+#include "qc_lc29_sentence_id.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#define LC29_SENTENCE_ID_HEADER(id, header) [id] = header,
+static const char *const lc29_sentence_id_headers[LC29_ID_COUNT] = {
+    [LC29_ID_UNKNOWN] = "", LC29_SENTENCE_IDS(LC29_SENTENCE_ID_HEADER)};
+#undef LC29_SENTENCE_ID_HEADER
+
+// Identifier length without the '$' and the terminator
+#define LC29_SENTENCE_ID_LENGTH(id, header) [id] = sizeof(header) - 2,
+static const uint8_t lc29_sentence_id_lengths[LC29_ID_COUNT] = {
+    LC29_SENTENCE_IDS(LC29_SENTENCE_ID_LENGTH)};
+#undef LC29_SENTENCE_ID_LENGTH
+
+static inline uint8_t lc29_sentence_id_slot(const char *id, uint8_t length) {
+  uint32_t key = (uint32_t)(uint8_t)id[length - 1] |
+                 (uint32_t)(uint8_t)id[length - 2] << 8 |
+                 (uint32_t)(uint8_t)id[length - 3] << 16 |
+                 (uint32_t)((uint8_t)id[4] ^ length) << 24;
+  return (uint8_t)((key * LC29_SENTENCE_ID_MULTIPLIER) >> 24);
+}
+
+/*
+  Identifier of every slot, LC29_ID_UNKNOWN for unused ones. Atomic so
+  threads making their first lookup at the same time may all fill it, they
+  store the same values; relaxed byte accesses are plain loads and stores.
+*/
+static _Atomic uint8_t lc29_sentence_id_slots[LC29_SENTENCE_ID_SLOTS];
+static atomic_bool lc29_sentence_id_ready;
+
+static void lc29_sentence_id_build(void) {
+  for (int id = LC29_ID_UNKNOWN + 1; id < LC29_ID_COUNT; id++) {
+    uint8_t slot = lc29_sentence_id_slot(&lc29_sentence_id_headers[id][1],
+                                         lc29_sentence_id_lengths[id]);
+    atomic_store_explicit(&lc29_sentence_id_slots[slot], (uint8_t)id,
+                          memory_order_relaxed);
+  }
+  atomic_store_explicit(&lc29_sentence_id_ready, true, memory_order_release);
+}
+
+/* id points right past the '$' */
+static qc_lc29x_sentence_id_t lc29_sentence_id_resolve(const char *id,
+                                                       size_t length) {
+  if (length < LC29_SENTENCE_ID_MIN_LENGTH ||
+      length > LC29_SENTENCE_ID_MAX_LENGTH) {
+    return LC29_ID_UNKNOWN;
+  }
+
+  if (!atomic_load_explicit(&lc29_sentence_id_ready, memory_order_acquire)) {
+    lc29_sentence_id_build();
+  }
+  uint8_t candidate =
+      atomic_load_explicit(&lc29_sentence_id_slots[lc29_sentence_id_slot(
+                               id, (uint8_t)length)],
+                           memory_order_relaxed);
+  // Anything hashing onto a used slot still has to be that identifier
+  if (lc29_sentence_id_lengths[candidate] != length ||
+      memcmp(id, &lc29_sentence_id_headers[candidate][1], length) != 0) {
+    return LC29_ID_UNKNOWN;
+  }
+  return (qc_lc29x_sentence_id_t)candidate;
+}
+
+qc_lc29x_sentence_id_t lc29_sentence_id(const char *sentence,
+                                        const qc_lc29x_sentence_info_s *info) {
+  return lc29_sentence_id_resolve(&sentence[1], info->id_length);
+}
+
+qc_lc29x_sentence_id_t lc29_sentence_id_lookup(const char *header) {
+  if ('$' == *header) {
+    header++;
+  }
+  return lc29_sentence_id_resolve(header, strlen(header));
+}
+
+const char *lc29_sentence_id_header(qc_lc29x_sentence_id_t id) {
+  return id < LC29_ID_COUNT ? lc29_sentence_id_headers[id] : "";
+}
@@ -0,0 +1,142 @@
+/*
+  Fleet benchmark: drives simulated LC29H modules over pty pairs from a single
+  thread and reports the CPU cost of the receive path.
+
+  Usage: gnss_drivers_bench [modules] [seconds] [rate_hz]
+  Defaults: 500 modules at 10 Hz for 5 seconds.
+
+  Each simulated module writes a GGA and an RMC sentence per epoch into the
+  master side of its pty; the fleet owns the slave sides.
+*/
+
+#define _GNU_SOURCE
+
+#include "gnss_driver_tests.h"
+#include "qc_lc29_linux_fleet.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+static const char epoch_output[] =
+    "$GNGGA,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*77\r\n"
+    "$GNRMC,123519.00,A,4807.038,N,01131.000,E,0.02,84.4,230394,,,A,V*30\r\n";
+
+static double now_seconds(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static double cpu_seconds(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return (double)usage.ru_utime.tv_sec + (double)usage.ru_utime.tv_usec / 1e6 +
+         (double)usage.ru_stime.tv_sec + (double)usage.ru_stime.tv_usec / 1e6;
+}
+
+static void count_sentence(void *context,
+                           const qc_lc29x_sentence_view_s *sentence) {
+  (void)sentence;
+  (*(uint64_t *)context)++;
+}
+
+int main(int argc, char *argv[]) {
+  int modules = argc > 1 ? atoi(argv[1]) : 500;
+  int seconds = argc > 2 ? atoi(argv[2]) : 5;
+  int rate_hz = argc > 3 ? atoi(argv[3]) : 10;
+  uint64_t received = 0;
+  struct rlimit files;
+
+  // Two fds per pty pair plus one epoll fd per serial
+  if (getrlimit(RLIMIT_NOFILE, &files) == 0 &&
+      files.rlim_cur < files.rlim_max) {
+    files.rlim_cur = files.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &files);
+  }
+
+  qc_lc29x_fleet_member_s *members = calloc(modules, sizeof(*members));
+  qc_lc29x_driver_storage_t *slots = calloc(modules, sizeof(*slots));
+  int *masters = calloc(modules, sizeof(*masters));
+  int *slaves = calloc(modules, sizeof(*slaves));
+  qc_lc29x_fleet_s fleet;
+  if (NULL == members || NULL == slots || NULL == masters || NULL == slaves ||
+      lc29_fleet_init(&fleet, members, slots, modules) != DRIVER_SUCCESS) {
+    fprintf(stderr, "fleet init failed\n");
+    return 1;
+  }
+
+  for (int i = 0; i < modules; i++) {
+    if (open_pty_pair(&masters[i], &slaves[i]) != 0) {
+      fprintf(stderr, "pty %d failed, raise the open file limit\n", i);
+      return 1;
+    }
+    int member = lc29_fleet_add(&fleet, slaves[i], 115200);
+    if (member < 0) {
+      fprintf(stderr, "fleet add %d failed\n", i);
+      return 1;
+    }
+    lc29_driver_set_sentence_handler(lc29_fleet_driver(&fleet, member),
+                                     LC29_SENTENCE_NMEA, count_sentence,
+                                     &received);
+  }
+
+  double period = 1.0 / rate_hz;
+  int epochs = seconds * rate_hz;
+  uint64_t wakeups = 0;
+  double start = now_seconds();
+  double cpu_start = cpu_seconds();
+  double next_epoch = start;
+  double write_cpu = 0;
+
+  for (int epoch = 0; epoch < epochs; epoch++) {
+    double write_start = cpu_seconds();
+    for (int i = 0; i < modules; i++) {
+      if (write(masters[i], epoch_output, sizeof(epoch_output) - 1) < 0) {
+        perror("write");
+        return 1;
+      }
+    }
+    write_cpu += cpu_seconds() - write_start;
+
+    next_epoch += period;
+    for (double now = now_seconds(); now < next_epoch; now = now_seconds()) {
+      int timeout_ms = (int)((next_epoch - now) * 1000.0) + 1;
+      if (lc29_fleet_run_once(&fleet, timeout_ms) > 0) {
+        wakeups++;
+      }
+    }
+  }
+  // Pick up what is still in flight
+  while (lc29_fleet_run_once(&fleet, 50) > 0) {
+    wakeups++;
+  }
+
+  double wall = now_seconds() - start;
+  double cpu = cpu_seconds() - cpu_start;
+  uint64_t expected = (uint64_t)epochs * modules * 2;
+
+  printf("modules          %d\n", modules);
+  printf("rate             %d Hz\n", rate_hz);
+  printf("wall time        %.2f s\n", wall);
+  printf("sentences        %llu / %llu\n", (unsigned long long)received,
+         (unsigned long long)expected);
+  printf("loop wakeups     %llu\n", (unsigned long long)wakeups);
+  printf("cpu total        %.1f %%\n", 100.0 * cpu / wall);
+  printf("cpu receive path %.1f %% (%.0f ns/sentence)\n",
+         100.0 * (cpu - write_cpu) / wall,
+         received ? 1e9 * (cpu - write_cpu) / (double)received : 0.0);
+
+  lc29_fleet_close(&fleet);
+  for (int i = 0; i < modules; i++) {
+    close(masters[i]);
+    close(slaves[i]);
+  }
+  free(members);
+  free(slots);
+  free(masters);
+  free(slaves);
+  return received == expected ? 0 : 1;
+}
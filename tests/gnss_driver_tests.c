@@ -1,8 +1,17 @@
 
 #include "qc_lc29_driver.h" // Make sure to include your header file
 #include "qc_lc29_driver_internal.h"
+#include "qc_lc29_epoch.h"
+#include "qc_lc29_nmea.h"
+#include "qc_lc29_scan.h"
+#include "qc_lc29_sentence_id.h"
 
 #include "gnss_driver_tests.h"
+#ifdef __linux__
+#include "qc_lc29_linux_fleet.h"
+#include "qc_lc29_linux_serial.h"
+#include <unistd.h>
+#endif
 
 #include <check.h>
 #include <stdint.h>
@@ -37,6 +46,38 @@ START_TEST(test_lc29_driver_parse_response) {
 }
 END_TEST
 
+START_TEST(test_lc29_driver_parse_reentrant) {
+  // Two responses back to back in one read-only buffer, nothing terminates
+  // the first one but its length
+  static const char traffic[] = "$PAIR001,050,1*3F\r\n$PAIR051,1000*13\r\n";
+  qc_lc29x_ack_reponse_t ack = CMD_SEND_SUCCESS;
+  int fix_rate = 0;
+
+  ck_assert_int_eq(lc29_driver_parse_cmd_response(traffic, 19, 50, &ack),
+                   VALID_RESPONSE);
+  ck_assert_int_eq(ack, COMAND_BEING_PROCESSED);
+  ck_assert_int_eq(lc29_driver_parse_query_result(&traffic[19], 19,
+                                                  PAIR_COMMON_GET_FIX_RATE, 1,
+                                                  &fix_rate),
+                   VALID_RESPONSE);
+  ck_assert_int_eq(fix_rate, 1000);
+
+  // Why a response was refused
+  ck_assert_int_eq(lc29_driver_parse_cmd_response(traffic, 19, 51, &ack),
+                   LC_RESPONSE_INVALID_FIELDS);
+  ck_assert_int_eq(lc29_driver_parse_cmd_response(&traffic[19], 19, 51, &ack),
+                   LC_RESPONSE_INVALID_IDENTIFIER);
+  ck_assert_int_eq(lc29_driver_parse_cmd_response(traffic, 12, 50, &ack),
+                   LC_RESPONSE_INVALID_R_N);
+  ck_assert_int_eq(lc29_driver_parse_query_result(&traffic[19], 19,
+                                                  PAIR_COMMON_GET_FIX_RATE, 2,
+                                                  &fix_rate),
+                   LC_RESPONSE_INVALID_FIELDS);
+  ck_assert_int_eq(ack, COMAND_BEING_PROCESSED);
+  ck_assert_int_eq(fix_rate, 1000);
+}
+END_TEST
+
 START_TEST(test_lc29_driver_validate_string) {
   char sentence[] = "$PAIR001,050,0*3E\n\r";
   size_t length = strlen(sentence);
@@ -59,9 +100,1274 @@ START_TEST(test_lc29_driver_pair_cmd_builder) {
   ck_assert_int_eq(lc29_driver_build_pair_cmd(num_args, cmd_id, args_test_1,
                                               fix_rate_packet),
                    VALID_RESPONSE);
+  ck_assert_str_eq(fix_rate_packet, "$PAIR050,100*22\r\n");
+
+  // Arguments that would overrun the buffer
+  char *args_test_2[] = {"0123456789012345678901234567890123456789"};
+  ck_assert_int_eq(lc29_driver_build_pair_cmd(num_args, cmd_id, args_test_2,
+                                              fix_rate_packet),
+                   LC_RESPONSE_INVALID_LENGTH);
+}
+END_TEST
+
+START_TEST(test_lc29_command_serializer) {
+  qc_lc29x_command_s command;
+  char buffer[LC29_CMD_MAX_LENGTH];
+
+  // Documented examples
+  lc29_command_begin(&command, buffer, sizeof(buffer), "$PAIR050");
+  lc29_command_arg_uint(&command, 1000);
+  ck_assert_uint_eq(lc29_command_end(&command), 18);
+  ck_assert_str_eq(buffer, "$PAIR050,1000*12\r\n");
+
+  lc29_command_begin(&command, buffer, sizeof(buffer), "$PAIR066");
+  lc29_command_arg_uint(&command, 1);
+  lc29_command_arg(&command, "1");
+  for (int i = 0; i < 4; i++) {
+    lc29_command_arg_int(&command, 0);
+  }
+  ck_assert_uint_eq(lc29_command_end(&command), strlen(buffer));
+  ck_assert_str_eq(buffer, "$PAIR066,1,1,0,0,0,0*3A\r\n");
+
+  lc29_command_begin(&command, buffer, sizeof(buffer), PAIR_NVM_SAVE_SETTING);
+  ck_assert_uint_eq(lc29_command_end(&command), 13);
+  ck_assert_str_eq(buffer, "$PAIR513*3D\r\n");
+
+  // Integer limits
+  lc29_command_begin(&command, buffer, sizeof(buffer), "$PAIR000");
+  lc29_command_arg_uint(&command, UINT32_MAX);
+  lc29_command_arg_int(&command, INT32_MIN);
+  ck_assert_uint_gt(lc29_command_end(&command), 0);
+  ck_assert_mem_eq(buffer, "$PAIR000,4294967295,-2147483648*", 32);
+
+  // Separators inside an argument
+  lc29_command_begin(&command, buffer, sizeof(buffer), "$PAIR050");
+  lc29_command_arg(&command, "100,1");
+  ck_assert_uint_eq(lc29_command_end(&command), 0);
+
+  // Exactly fits, then one char short
+  char small[18];
+  lc29_command_begin(&command, small, sizeof(small), "$PAIR050");
+  lc29_command_arg_uint(&command, 100);
+  ck_assert_uint_eq(lc29_command_end(&command), 17);
+  ck_assert_str_eq(small, "$PAIR050,100*22\r\n");
+  lc29_command_begin(&command, small, sizeof(small) - 1, "$PAIR050");
+  lc29_command_arg_uint(&command, 100);
+  ck_assert_uint_eq(lc29_command_end(&command), 0);
+}
+END_TEST
+
+/*
+ *
+ *   LC29 Sentence Framer Tests
+ *
+ */
+START_TEST(test_lc29_framer_split_and_merged_chunks) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s sentence;
+  lc29_framer_init(&framer);
+
+  // One sentence split over three chunks
+  ck_assert_int_eq(lc29_framer_push(&framer, "$PAIR001,0", 10), 0);
+  ck_assert_int_eq(lc29_framer_push(&framer, "50,0*3", 6), 0);
+  ck_assert_int_eq(lc29_framer_push(&framer, "E\r\n", 3), 1);
+
+  // Two sentences and some line noise in a single chunk
+  char burst[] = "\r\n$PAIR001,051,0*3F\r\n$PAIR051,1000*13\r\n$PAIR";
+  ck_assert_int_eq(lc29_framer_push(&framer, burst, strlen(burst)), 2);
+  ck_assert_int_eq(lc29_framer_pending(&framer), 3);
+
+  ck_assert(lc29_framer_next(&framer, &sentence));
+  ck_assert_str_eq(sentence.data, "$PAIR001,050,0*3E\r\n");
+  ck_assert_int_eq(sentence.length, 19);
+  ck_assert(lc29_framer_next(&framer, &sentence));
+  ck_assert_str_eq(sentence.data, "$PAIR001,051,0*3F\r\n");
+  ck_assert(lc29_framer_next(&framer, &sentence));
+  ck_assert_str_eq(sentence.data, "$PAIR051,1000*13\r\n");
+  ck_assert(!lc29_framer_next(&framer, &sentence));
+
+  // A new start char drops the truncated sentence
+  ck_assert_int_eq(lc29_framer_push(&framer, "$PAIR059,15*1E\r\n", 16), 1);
+  ck_assert(lc29_framer_next(&framer, &sentence));
+  ck_assert_str_eq(sentence.data, "$PAIR059,15*1E\r\n");
+  ck_assert_int_eq(framer.dropped, 1);
+}
+END_TEST
+
+START_TEST(test_lc29_framer_ring_wrap) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s sentence;
+  char gga[] = "$GNGGA,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,"
+               "46.9,M,,*77\r\n";
+  lc29_framer_init(&framer);
+
+  // Sentences keep their contents while cycling through the ring many times
+  for (int i = 0; i < 100; i++) {
+    ck_assert_int_eq(lc29_framer_push(&framer, gga, strlen(gga)), 1);
+    ck_assert(lc29_framer_next(&framer, &sentence));
+    ck_assert_int_eq(sentence.length, strlen(gga));
+    ck_assert_str_eq(sentence.data, gga);
+  }
+
+  // Once the ring is full the oldest unconsumed sentences make room
+  for (int i = 0; i < 40; i++) {
+    ck_assert_int_eq(lc29_framer_push(&framer, gga, strlen(gga)), 1);
+  }
+  ck_assert_int_gt(framer.overruns, 0);
+  ck_assert_int_eq(lc29_framer_pending(&framer) + framer.overruns, 40);
+  ck_assert(lc29_framer_next(&framer, &sentence));
+  ck_assert_str_eq(sentence.data, gga);
+}
+END_TEST
+
+START_TEST(test_lc29_sentence_id_hash) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s sentence;
+  char custom_output[] = "$PAIR6010,1,0*0C\r\n";
+  char prefixes[] = "$PAIR601,1*20\r\n$PAIR60101,1*21\r\n";
+
+  // Every listed header hashes onto its own slot
+  for (qc_lc29x_sentence_id_t id = LC29_ID_UNKNOWN + 1; id < LC29_ID_COUNT;
+       id++) {
+    const char *header = lc29_sentence_id_header(id);
+    ck_assert_msg(lc29_sentence_id_lookup(header) == id, "%s collides",
+                  header);
+    ck_assert_int_ge(strlen(header) - 1, LC29_SENTENCE_ID_MIN_LENGTH);
+    ck_assert_int_le(strlen(header) - 1, LC29_SENTENCE_ID_MAX_LENGTH);
+  }
+  ck_assert_int_eq(lc29_sentence_id_lookup(PAIR_GET_CUSTOM_MSG_OUTPUT),
+                   LC29_ID_PAIR_GET_CUSTOM_MSG_OUTPUT);
+  ck_assert_int_eq(lc29_sentence_id_lookup("PQTMCFGEINSMSGOK"),
+                   LC29_ID_DR_RESPONSE_OK);
+  ck_assert_int_eq(lc29_sentence_id_lookup("$PAIR601"), LC29_ID_UNKNOWN);
+  ck_assert_int_eq(lc29_sentence_id_lookup("$PAIR60101"), LC29_ID_UNKNOWN);
+  ck_assert_int_eq(lc29_sentence_id_lookup("$GNGGA"), LC29_ID_UNKNOWN);
+  ck_assert_str_eq(lc29_sentence_id_header(LC29_ID_UNKNOWN), "");
+
+  // Identifiers that share a prefix resolve by their full length
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, prefixes, strlen(prefixes)), 2);
+  ck_assert(lc29_framer_next(&framer, &sentence));
+  ck_assert_int_eq(sentence.info->id, LC29_ID_UNKNOWN);
+  ck_assert(lc29_framer_next(&framer, &sentence));
+  ck_assert_int_eq(sentence.info->id, LC29_ID_UNKNOWN);
+
+  // The identifier is resolved wherever the sentence sits in the ring
+  for (int i = 0; i < 200; i++) {
+    ck_assert_int_eq(
+        lc29_framer_push(&framer, custom_output, strlen(custom_output)), 1);
+    ck_assert(lc29_framer_next(&framer, &sentence));
+    ck_assert_int_eq(sentence.info->id, LC29_ID_PAIR_SET_CUSTOM_MSG_OUTPUT);
+    ck_assert_int_eq(sentence.sentence_class, LC29_SENTENCE_PAIR_RESPONSE);
+  }
+}
+END_TEST
+
+START_TEST(test_lc29_scan_kernels) {
+  qc_lc29x_scan_entry_s entries[8];
+  size_t consumed;
+  char log[400];
+  const char *frames[] = {
+      "$GNGGA,092725.000,4717.113210,N,00833.915187,E,1,08,1.01,499.617,M,"
+      "48.000,M,,*77\r\n",
+      "$PAIR001,062,0*3F\r\n",
+      "$PAIR001,062,0*3E\r\n", // wrong checksum
+      "$PAIR001,062,0\r\n",    // no checksum
+      "$GNVTG,84.40,T,,M,0.02,N,0.04,K,A*1d\n",
+  };
+  const bool valid[] = {true, true, false, false, true};
+
+  // Noise, a frame cut short by the next '$', the frames, a partial one
+  strcpy(log, "noise\n$GNGSA,A,3");
+  for (size_t i = 0; i < 5; i++) {
+    strcat(log, frames[i]);
+  }
+  strcat(log, "$GNRMC,0927");
+
+  for (int kernel = LC29_SCAN_SCALAR; kernel <= LC29_SCAN_AVX2; kernel++) {
+    if (!lc29_scan_use_kernel(kernel)) {
+      continue;
+    }
+    ck_assert_int_eq(lc29_scan_kernel(), kernel);
+    ck_assert_int_eq(lc29_scan_sentences(log, strlen(log), entries, 8,
+                                         &consumed),
+                     5);
+    ck_assert_uint_eq(consumed, strlen(log) - strlen("$GNRMC,0927"));
+    for (size_t i = 0; i < 5; i++) {
+      ck_assert_int_eq(entries[i].length, strlen(frames[i]));
+      ck_assert_mem_eq(&log[entries[i].start], frames[i], strlen(frames[i]));
+      ck_assert_int_eq(entries[i].checksum,
+                       lc29_driver_get_checksum(frames[i]));
+      ck_assert_int_eq(entries[i].valid, valid[i]);
+    }
+
+    // Out of entries, scanning resumes at the first frame not reported
+    ck_assert_int_eq(lc29_scan_sentences(log, strlen(log), entries, 2,
+                                         &consumed),
+                     2);
+    ck_assert_uint_eq(consumed, (size_t)(strstr(log, frames[2]) - log));
+
+    // Checksums across every vector width and tail length
+    for (size_t length = 0; length < 100; length++) {
+      uint8_t expected = 0;
+      for (size_t i = 0; i < length; i++) {
+        expected ^= (uint8_t)log[i];
+      }
+      ck_assert_int_eq(lc29_scan_checksum(log, length), expected);
+    }
+  }
+  ck_assert(lc29_scan_use_kernel(LC29_SCAN_AUTO));
+}
+END_TEST
+
+START_TEST(test_lc29_parser_incremental) {
+  qc_lc29x_parser_s parser;
+  char sentence[] = "$PAIR067,1,0,0,0,0,0*3A\r\n";
+  qc_lc29x_parse_result_t result = LC29_PARSE_IN_PROGRESS;
+  lc29_parser_init(&parser);
+
+  // Nothing is reported until the '\n' lands
+  for (size_t i = 0; i < strlen(sentence) - 1; i++) {
+    ck_assert_int_eq(lc29_parser_feed(&parser, sentence[i]),
+                     LC29_PARSE_IN_PROGRESS);
+  }
+  result = lc29_parser_feed(&parser, '\n');
+  ck_assert_int_eq(result, LC29_PARSE_SENTENCE_OK);
+  ck_assert_int_eq(parser.info.checksum, 0x3A);
+  ck_assert_int_eq(parser.info.num_fields, 7);
+  ck_assert_int_eq(parser.info.id_length, 7);
+  ck_assert_int_eq(parser.info.fields[1], 9);
+  ck_assert_int_eq(parser.info.fields[6], 19);
+  ck_assert_int_eq(lc29_sentence_field_length(&parser.info, 0), 7);
+  ck_assert_int_eq(lc29_sentence_field_length(&parser.info, 6), 1);
+  ck_assert(lc29_sentence_id_equals(sentence, &parser.info,
+                                    PAIR_COMMON_GET_GNSS_SEARCH_MODE));
+  ck_assert(!lc29_sentence_id_equals(sentence, &parser.info, "$PAIR06"));
+
+  ck_assert_int_eq(lc29_parser_parse(&parser, "$PAIR059,15*1F\r\n", 16),
+                   LC29_PARSE_INVALID_CHECKSUM);
+  ck_assert_int_eq(lc29_parser_parse(&parser, "$PAIR059,15\r\n", 13),
+                   LC29_PARSE_NO_CHECKSUM);
+  ck_assert_int_eq(lc29_parser_parse(&parser, "$PAIR059,15*1E", 14),
+                   LC29_PARSE_IN_PROGRESS);
+
+  // The framer only queues sentences that pass the checksum
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s view;
+  char stream[] = "$PAIR059,15*1F\r\n$PAIR059,15*1E\r\n";
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, stream, strlen(stream)), 1);
+  ck_assert_int_eq(framer.checksum_errors, 1);
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(view.info->num_fields, 2);
+  ck_assert_int_eq(atoi(&view.data[view.info->fields[1]]), 15);
+}
+END_TEST
+
+START_TEST(test_lc29_sentence_field_accessors) {
+  qc_lc29x_parser_s parser;
+  const char sentence[] =
+      "$GNTST,-42,12.3456,-0.5,1F,A,,2147483648,+1*77\r\n";
+  const char *data = sentence;
+  const qc_lc29x_sentence_info_s *info = &parser.info;
+  int32_t value = 7;
+  uint32_t hex;
+  uint8_t length;
+  char c;
+
+  ck_assert_int_eq(lc29_parser_parse(&parser, sentence, strlen(sentence)),
+                   LC29_PARSE_SENTENCE_OK);
+  ck_assert_ptr_eq(lc29_sentence_field(data, info, 2, &length), &data[11]);
+  ck_assert_int_eq(length, 7);
+  ck_assert_ptr_null(lc29_sentence_field(data, info, 9, &length));
+
+  ck_assert(lc29_sentence_field_int(data, info, 1, &value));
+  ck_assert_int_eq(value, -42);
+  ck_assert(lc29_sentence_field_decimal(data, info, 2, 3, &value));
+  ck_assert_int_eq(value, 12345);
+  ck_assert(lc29_sentence_field_decimal(data, info, 3, 2, &value));
+  ck_assert_int_eq(value, -50);
+  ck_assert(lc29_sentence_field_hex(data, info, 4, &hex));
+  ck_assert_uint_eq(hex, 0x1F);
+  ck_assert(lc29_sentence_field_char(data, info, 5, &c));
+  ck_assert_int_eq(c, 'A');
+  ck_assert(lc29_sentence_field_char(data, info, 6, &c));
+  ck_assert_int_eq(c, '\0');
+
+  // Wrong type, empty, signed with +, out of range or missing: value is left
+  // alone
+  value = 7;
+  ck_assert(!lc29_sentence_field_int(data, info, 2, &value));
+  ck_assert(!lc29_sentence_field_int(data, info, 6, &value));
+  ck_assert(!lc29_sentence_field_int(data, info, 7, &value));
+  ck_assert(!lc29_sentence_field_int(data, info, 8, &value));
+  ck_assert(!lc29_sentence_field_int(data, info, 9, &value));
+  ck_assert(!lc29_sentence_field_decimal(data, info, 2, 9, &value));
+  ck_assert(!lc29_sentence_field_decimal(data, info, 8, 0, &value));
+  ck_assert(!lc29_sentence_field_hex(data, info, 8, &hex));
+  ck_assert(!lc29_sentence_field_char(data, info, 8, &c));
+  ck_assert_int_eq(value, 7);
+
+  // The query parser reads through the index, the response is not modified
+  char response[] = "$PAIR067,1,0,0,0,0,0*3A\r\n";
+  int values[6];
+  ck_assert_int_eq(lc29_driver_parse_query_response(
+                       response, PAIR_COMMON_GET_GNSS_SEARCH_MODE,
+                       strlen(response), 6, values),
+                   CMD_SEND_SUCCESS);
+  ck_assert_int_eq(values[0], 1);
+  ck_assert_str_eq(response, "$PAIR067,1,0,0,0,0,0*3A\r\n");
+}
+END_TEST
+
+START_TEST(test_lc29_nmea_gga) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s view;
+  qc_lc29x_gga_s gga;
+  char stream[] =
+      "$GNGGA,092725.000,4717.113210,N,00833.915187,E,1,08,1.01,499.617,M,"
+      "48.000,M,,*77\r\n"
+      "$GPGGA,123519.00,4807.0380,S,01131.0000,W,2,12,0.9,-45.4,M,-46.9,M,,"
+      "*5B\r\n"
+      "$GNGGA,,,,,,0,00,99.99,,,,,,*56\r\n"
+      "$GNRMC,092725.000,A,4717.113210,N,00833.915187,E,0.02,84.4,230394,,,"
+      "A,V*0A\r\n";
+
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, stream, strlen(stream)), 4);
+
+  // Laid out as LAT_LON_6_ALT_3 prescribes
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gga(&view, LAT_LON_6_ALT_3, &gga),
+                   LC29_NMEA_OK);
+  ck_assert(gga.has_time && gga.has_position && gga.has_altitude);
+  ck_assert_uint_eq(gga.utc_time_ms, ((9 * 60 + 27) * 60 + 25) * 1000);
+  ck_assert_int_eq(gga.latitude, 472852202);
+  ck_assert_int_eq(gga.longitude, 85652531);
+  ck_assert_int_eq(gga.altitude_mm, 499617);
+  ck_assert_int_eq(gga.geoid_separation_mm, 48000);
+  ck_assert_int_eq(gga.fix_quality, LC29_FIX_GPS);
+  ck_assert_int_eq(gga.num_satellites, 8);
+  ck_assert_int_eq(gga.hdop, 101);
+
+  // Other digit counts than configured still decode, south and west negative
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gga(&view, LAT_LON_6_ALT_3, &gga),
+                   LC29_NMEA_OK);
+  ck_assert_uint_eq(gga.utc_time_ms, ((12 * 60 + 35) * 60 + 19) * 1000);
+  ck_assert_int_eq(gga.latitude, -481173000);
+  ck_assert_int_eq(gga.longitude, -115166667);
+  ck_assert_int_eq(gga.altitude_mm, -45400);
+  ck_assert_int_eq(gga.geoid_separation_mm, -46900);
+  ck_assert_int_eq(gga.fix_quality, LC29_FIX_DGPS);
+  ck_assert_int_eq(gga.hdop, 90);
+
+  // Same sentence laid out as LAT_LON_4_ALT_1 prescribes
+  ck_assert_int_eq(lc29_nmea_decode_gga(&view, LAT_LON_4_ALT_1, &gga),
+                   LC29_NMEA_OK);
+  ck_assert_int_eq(gga.latitude, -481173000);
+  ck_assert_int_eq(gga.longitude, -115166667);
+  ck_assert_int_eq(gga.altitude_mm, -45400);
+  ck_assert_int_eq(gga.geoid_separation_mm, -46900);
+
+  // No fix yet
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gga(&view, LAT_LON_4_ALT_1, &gga),
+                   LC29_NMEA_OK);
+  ck_assert(!gga.has_time && !gga.has_position && !gga.has_altitude);
+  ck_assert_int_eq(gga.fix_quality, LC29_FIX_INVALID);
+  ck_assert_int_eq(gga.hdop, 9999);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gga(&view, LAT_LON_6_ALT_3, &gga),
+                   LC29_NMEA_WRONG_SENTENCE);
+}
+END_TEST
+
+START_TEST(test_lc29_nmea_rmc_vtg) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s view;
+  qc_lc29x_date_cache_s cache;
+  qc_lc29x_rmc_s rmc;
+  qc_lc29x_vtg_s vtg;
+  char stream[] =
+      "$GNRMC,092725.000,A,4717.113210,N,00833.915187,E,0.02,84.40,160526,,,"
+      "A,V*33\r\n"
+      "$GNRMC,000000.500,V,,,,,,,170526,,,N,V*2B\r\n"
+      "$GNVTG,84.40,T,,M,0.02,N,0.04,K,A*1D\r\n"
+      "$GPVTG,,T,,M,1.5,N,,K,N*06\r\n";
+
+  lc29_nmea_date_cache_init(&cache);
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, stream, strlen(stream)), 4);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_rmc(&view, LAT_LON_6_ALT_3, &cache, &rmc),
+                   LC29_NMEA_OK);
+  ck_assert(rmc.valid && rmc.has_position && rmc.has_course);
+  ck_assert_uint_eq(rmc.utc_epoch_ns, 1778923645000000000ull);
+  ck_assert_int_eq(rmc.latitude, 472852202);
+  ck_assert_int_eq(rmc.longitude, 85652531);
+  ck_assert_uint_eq(rmc.speed_mm_s, 10);
+  ck_assert_uint_eq(rmc.course_cdeg, 8440);
+  ck_assert_int_eq(rmc.mode, 'A');
+  ck_assert_uint_eq(cache.date, 160526);
+
+  // Same date again comes from the cache
+  ck_assert_int_eq(lc29_nmea_decode_rmc(&view, LAT_LON_6_ALT_3, &cache, &rmc),
+                   LC29_NMEA_OK);
+  ck_assert_uint_eq(rmc.utc_epoch_ns, 1778923645000000000ull);
+
+  // Day rollover, no fix
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_rmc(&view, LAT_LON_6_ALT_3, &cache, &rmc),
+                   LC29_NMEA_OK);
+  ck_assert(!rmc.valid && !rmc.has_position && !rmc.has_course);
+  ck_assert_uint_eq(rmc.utc_epoch_ns, 1778976000500000000ull);
+  ck_assert_uint_eq(cache.date, 170526);
+  ck_assert_int_eq(rmc.mode, 'N');
+  ck_assert_int_eq(lc29_nmea_decode_rmc(&view, LAT_LON_6_ALT_3, NULL, &rmc),
+                   LC29_NMEA_OK);
+  ck_assert_uint_eq(rmc.utc_epoch_ns, 1778976000500000000ull);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_rmc(&view, LAT_LON_6_ALT_3, &cache, &rmc),
+                   LC29_NMEA_WRONG_SENTENCE);
+  ck_assert_int_eq(lc29_nmea_decode_vtg(&view, &vtg), LC29_NMEA_OK);
+  ck_assert(vtg.has_course && vtg.has_speed);
+  ck_assert_uint_eq(vtg.course_cdeg, 8440);
+  ck_assert_uint_eq(vtg.speed_mm_s, 11); // from the km/h field
+  ck_assert_int_eq(vtg.mode, 'A');
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_vtg(&view, &vtg), LC29_NMEA_OK);
+  ck_assert(!vtg.has_course && vtg.has_speed);
+  ck_assert_uint_eq(vtg.speed_mm_s, 772); // from the knots field
+}
+END_TEST
+
+START_TEST(test_lc29_nmea_gsv_table) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s view;
+  qc_lc29x_gsv_table_s table;
+  qc_lc29x_snr_stats_s stats[LC29_CONSTELLATION_COUNT];
+  char epoch[] =
+      "$GPGSV,3,1,09,01,45,083,42,02,17,308,35,03,62,120,47,04,05,270,,1*68\r\n"
+      "$GPGSV,3,2,09,05,23,045,30,06,,,,07,80,000,50,08,33,190,28,1*5C\r\n"
+      "$GPGSV,3,3,09,09,12,333,25,1*53\r\n"
+      "$GLGSV,1,1,02,65,40,100,38,66,10,200,,1*74\r\n"
+      "$GPGSV,1,1,02,01,45,083,39,03,62,120,44,8*6A\r\n";
+  char broken[] =
+      "$GPGSV,3,1,09,01,45,083,42,02,17,308,35,03,62,120,47,04,05,270,,1*68\r\n"
+      "$GPGSV,3,3,09,09,12,333,25,1*53\r\n"
+      "$GAGSV,2,2,05,30,10,010,20,7*47\r\n";
+
+  lc29_nmea_gsv_table_reset(&table);
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, epoch, strlen(epoch)), 5);
+  while (lc29_framer_next(&framer, &view)) {
+    ck_assert_int_eq(lc29_nmea_decode_gsv(&view, &table), LC29_NMEA_OK);
+  }
+  ck_assert(lc29_nmea_gsv_complete(&table));
+  ck_assert_int_eq(table.count, 13);
+  ck_assert_int_eq(table.prn[5], 6);
+  ck_assert_int_eq(table.elevation[5], LC29_GSV_UNKNOWN_ELEVATION);
+  ck_assert_int_eq(table.azimuth[5], LC29_GSV_UNKNOWN_AZIMUTH);
+  ck_assert_int_eq(table.snr[5], 0);
+  ck_assert_int_eq(table.prn[9], 65);
+  ck_assert_int_eq(table.constellation[9], GLONASS);
+  ck_assert_int_eq(table.elevation[9], 40);
+  ck_assert_int_eq(table.azimuth[9], 100);
+  ck_assert_int_eq(table.signal[11], 8); // GPS L5
+  ck_assert_int_eq(table.snr[12], 44);
+
+  lc29_nmea_gsv_snr_stats(&table, stats);
+  ck_assert_int_eq(stats[GPS].in_view, 11);
+  ck_assert_int_eq(stats[GPS].tracked, 9);
+  ck_assert_int_eq(stats[GPS].snr_max, 50);
+  ck_assert_int_eq(stats[GPS].snr_mean, 38);
+  ck_assert_int_eq(stats[GLONASS].in_view, 2);
+  ck_assert_int_eq(stats[GLONASS].tracked, 1);
+  ck_assert_int_eq(stats[GLONASS].snr_mean, 38);
+  ck_assert_int_eq(stats[GALILEO].in_view, 0);
+  ck_assert_int_eq(stats[GALILEO].snr_mean, 0);
+
+  // The next epoch replaces the table, a missing part drops its sequence
+  ck_assert_int_eq(lc29_framer_push(&framer, broken, strlen(broken)), 3);
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gsv(&view, &table), LC29_NMEA_OK);
+  ck_assert_int_eq(table.count, 4);
+  ck_assert(!lc29_nmea_gsv_complete(&table));
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gsv(&view, &table),
+                   LC29_NMEA_OUT_OF_SEQUENCE);
+  ck_assert_int_eq(table.count, 0);
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gsv(&view, &table),
+                   LC29_NMEA_OUT_OF_SEQUENCE);
+}
+END_TEST
+
+START_TEST(test_lc29_nmea_gsa_used_satellites) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s view;
+  qc_lc29x_gsv_table_s table;
+  qc_lc29x_gsa_s gsa;
+  uint64_t tracked[LC29_CONSTELLATION_COUNT];
+  char epoch[] =
+      "$GNGSA,A,3,01,02,03,05,07,,,,,,,,1.50,0.90,1.20,1*0D\r\n"
+      "$GNGSA,A,3,65,66,,,,,,,,,,,1.50,0.90,1.20,2*0F\r\n"
+      "$GPGSV,2,1,06,01,45,083,42,02,17,308,35,03,62,120,47,05,23,045,,1*67\r\n"
+      "$GPGSV,2,2,06,07,80,000,50,09,12,333,25,1*66\r\n"
+      "$GLGSV,1,1,02,65,40,100,38,66,10,200,,1*74\r\n"
+      "$GPGSA,M,2,04,,,,,,,,,,,,9.99,9.99,9.99*02\r\n";
+
+  lc29_nmea_gsa_reset(&gsa);
+  lc29_nmea_gsv_table_reset(&table);
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, epoch, strlen(epoch)), 6);
+
+  for (int i = 0; i < 2; i++) {
+    ck_assert(lc29_framer_next(&framer, &view));
+    ck_assert_int_eq(lc29_nmea_decode_gsa(&view, &gsa), LC29_NMEA_OK);
+  }
+  ck_assert_int_eq(gsa.fix_type, 3);
+  ck_assert_int_eq(gsa.selection_mode, 'A');
+  ck_assert_int_eq(gsa.system_id, 2); // the last one, GLONASS
+  ck_assert_int_eq(gsa.pdop, 150);
+  ck_assert_int_eq(gsa.hdop, 90);
+  ck_assert_int_eq(gsa.vdop, 120);
+  ck_assert_uint_eq(gsa.used[GPS], 0xAEu); // 1, 2, 3, 5, 7
+  ck_assert_uint_eq(gsa.used[GLONASS], 0x6u);
+  ck_assert_uint_eq(gsa.used[GALILEO], 0);
+
+  for (int i = 0; i < 3; i++) {
+    ck_assert(lc29_framer_next(&framer, &view));
+    ck_assert_int_eq(lc29_nmea_decode_gsv(&view, &table), LC29_NMEA_OK);
+  }
+  ck_assert_int_eq(lc29_nmea_decode_gsa(&view, &gsa),
+                   LC29_NMEA_WRONG_SENTENCE);
+
+  // Used in the fix and tracked, used but no longer tracked
+  lc29_nmea_gsv_satellite_sets(&table, 1, tracked);
+  ck_assert_uint_eq(gsa.used[GPS] & tracked[GPS], 0x8Eu);
+  ck_assert_uint_eq(gsa.used[GPS] & ~tracked[GPS], 1u << 5);
+  ck_assert_uint_eq(gsa.used[GLONASS] & tracked[GLONASS], 0x2u);
+  lc29_nmea_gsv_satellite_sets(&table, 0, tracked);
+  ck_assert_uint_eq(tracked[GLONASS], 0x6u);
+
+  // NMEA 3.01 sentence without a system ID
+  lc29_nmea_gsa_reset(&gsa);
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_gsa(&view, &gsa), LC29_NMEA_OK);
+  ck_assert_int_eq(gsa.fix_type, 2);
+  ck_assert_int_eq(gsa.selection_mode, 'M');
+  ck_assert_int_eq(gsa.system_id, 0); // NMEA 4.10 ID is missing
+  ck_assert_uint_eq(gsa.used[GPS], 1u << 4);
+  ck_assert_int_eq(gsa.pdop, 999);
+}
+END_TEST
+
+START_TEST(test_lc29_nmea_pqtm_dr_output) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s view;
+  qc_lc29x_pqtm_ins_s ins;
+  qc_lc29x_pqtm_imu_s imu;
+  qc_lc29x_pqtm_gps_s gps;
+  char output[] =
+      "$PQTMINS,43275714,2,31.82072069,-117.11531216,43.364,-0.011,0.118,"
+      "0.009,1.363,-0.046,315.762*55\r\n"
+      "$PQTMINS,1200,0,,,,,,,,,*53\r\n"
+      "$PQTMIMU,43275714,-0.0264,0.0176,1.0015,0.0125,-0.0625,250.1234,1234,"
+      "43275700*65\r\n"
+      "$PQTMIMU,43275724,0.0010,-0.0020,0.9990,0.0000,0.0000,-0.5000*6C\r\n"
+      "$PQTMGPS,43275714,120520.500,31.82072069,117.11531216,43.364,12.345,"
+      "95.620,0.715,0.83,3,27*42\r\n"
+      "$PQTMGPS,43275714,120520.500,95.1,117.1,43.364,12.345,95.620,0.715,"
+      "0.83,3,27*4E\r\n";
+
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, output, strlen(output)), 6);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(view.sentence_class, LC29_SENTENCE_PQTM);
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_imu(&view, &imu),
+                   LC29_NMEA_WRONG_SENTENCE);
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_ins(&view, &ins), LC29_NMEA_OK);
+  ck_assert_uint_eq(ins.timestamp_ms, 43275714);
+  ck_assert_int_eq(ins.solution_type, 2);
+  ck_assert(ins.has_position && ins.has_velocity && ins.has_attitude);
+  ck_assert_int_eq(ins.latitude, 318207206); // 8th decimal truncated
+  ck_assert_int_eq(ins.longitude, -1171153121);
+  ck_assert_int_eq(ins.height_mm, 43364);
+  ck_assert_int_eq(ins.velocity_mm_s[0], -11);
+  ck_assert_int_eq(ins.velocity_mm_s[1], 118);
+  ck_assert_int_eq(ins.velocity_mm_s[2], 9);
+  ck_assert_int_eq(ins.roll_mdeg, 1363);
+  ck_assert_int_eq(ins.pitch_mdeg, -46);
+  ck_assert_int_eq(ins.heading_mdeg, 315762);
+
+  // Pending solution
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_ins(&view, &ins), LC29_NMEA_OK);
+  ck_assert_uint_eq(ins.timestamp_ms, 1200);
+  ck_assert_int_eq(ins.solution_type, 0);
+  ck_assert(!ins.has_position && !ins.has_velocity && !ins.has_attitude);
+  ck_assert_int_eq(ins.latitude, 0);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_imu(&view, &imu), LC29_NMEA_OK);
+  ck_assert_uint_eq(imu.timestamp_ms, 43275714);
+  ck_assert_int_eq(imu.acceleration_ug[0], -26400);
+  ck_assert_int_eq(imu.acceleration_ug[1], 17600);
+  ck_assert_int_eq(imu.acceleration_ug[2], 1001500);
+  ck_assert_int_eq(imu.angular_rate_udps[0], 12500);
+  ck_assert_int_eq(imu.angular_rate_udps[1], -62500);
+  ck_assert_int_eq(imu.angular_rate_udps[2], 250123400);
+  ck_assert(imu.has_wheel_ticks);
+  ck_assert_uint_eq(imu.wheel_ticks, 1234);
+  ck_assert_uint_eq(imu.wheel_tick_timestamp_ms, 43275700);
+
+  // Without wheel ticks
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_imu(&view, &imu), LC29_NMEA_OK);
+  ck_assert(!imu.has_wheel_ticks);
+  ck_assert_int_eq(imu.acceleration_ug[2], 999000);
+  ck_assert_int_eq(imu.angular_rate_udps[2], -500000);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_gps(&view, &gps), LC29_NMEA_OK);
+  ck_assert_uint_eq(gps.timestamp_ms, 43275714);
+  ck_assert_uint_eq(gps.time_of_week_ms, 120520500);
+  ck_assert(gps.has_position);
+  ck_assert_int_eq(gps.latitude, 318207206);
+  ck_assert_int_eq(gps.longitude, 1171153121);
+  ck_assert_int_eq(gps.height_mm, 43364);
+  ck_assert_uint_eq(gps.speed_mm_s, 12345);
+  ck_assert_int_eq(gps.heading_mdeg, 95620);
+  ck_assert_uint_eq(gps.horizontal_accuracy_mm, 715);
+  ck_assert_int_eq(gps.hdop, 83);
+  ck_assert_int_eq(gps.solution_type, 3);
+  ck_assert_int_eq(gps.num_satellites, 27);
+
+  // Latitude out of range
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_gps(&view, &gps),
+                   LC29_NMEA_INVALID_FIELD);
+}
+END_TEST
+
+START_TEST(test_lc29_nmea_pqtm_dr_messages) {
+  qc_lc29x_framer_s framer;
+  qc_lc29x_sentence_view_s view;
+  qc_lc29x_pqtm_drcal_s drcal;
+  qc_lc29x_pqtm_drpva_s drpva;
+  qc_lc29x_pqtm_vehmot_s vehmot;
+  qc_lc29x_pqtm_senmsg_s senmsg;
+  char output[] =
+      "$PQTMDRCAL,1,2,3*5C\r\n"
+      "$PQTMDRCAL,2,2,3*5F\r\n"
+      "$PQTMDRPVA,1,43275714,092725.000,3,31.82072069,117.11531216,43.364,"
+      "-3.120,-0.011,0.118,0.009,0.119,1.363,-0.046,315.762*7C\r\n"
+      "$PQTMDRPVA,1,1200,,0,,,,,,,,,,,*67\r\n"
+      "$PQTMVEHMOT,1,43275714,-1.250,0.0100,-0.0200,0.9990,0.0000,0.1500,"
+      "-2.5000*01\r\n"
+      "$PQTMSENMSG,1,43275714,35.20,-0.0264,0.0176,1.0015,0.0125,-0.0625,"
+      "0.5000,8.330*26\r\n"
+      "$PQTMSENMSG,1,43275714,-5.5,-0.0264,0.0176,1.0015,0.0125,-0.0625,"
+      "0.5000*05\r\n";
+
+  lc29_framer_init(&framer);
+  ck_assert_int_eq(lc29_framer_push(&framer, output, strlen(output)), 7);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_drpva(&view, &drpva),
+                   LC29_NMEA_WRONG_SENTENCE);
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_drcal(&view, &drcal), LC29_NMEA_OK);
+  ck_assert_int_eq(drcal.calibration_state, LC29_DR_FULLY_CALIBRATED);
+  ck_assert_int_eq(drcal.nav_type, LC29_DR_NAV_COMBINATION);
+  // Unknown message version
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_drcal(&view, &drcal),
+                   LC29_NMEA_INVALID_FIELD);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_drpva(&view, &drpva), LC29_NMEA_OK);
+  ck_assert_uint_eq(drpva.timestamp_ms, 43275714);
+  ck_assert(drpva.has_time && drpva.has_position && drpva.has_velocity &&
+            drpva.has_attitude);
+  ck_assert_uint_eq(drpva.utc_time_ms, 34045000);
+  ck_assert_int_eq(drpva.nav_type, LC29_DR_NAV_COMBINATION);
+  ck_assert_int_eq(drpva.latitude, 318207206);
+  ck_assert_int_eq(drpva.longitude, 1171153121);
+  ck_assert_int_eq(drpva.altitude_mm, 43364);
+  ck_assert_int_eq(drpva.geoid_separation_mm, -3120);
+  ck_assert_int_eq(drpva.velocity_mm_s[0], -11);
+  ck_assert_int_eq(drpva.velocity_mm_s[2], 9);
+  ck_assert_uint_eq(drpva.speed_mm_s, 119);
+  ck_assert_int_eq(drpva.roll_mdeg, 1363);
+  ck_assert_int_eq(drpva.pitch_mdeg, -46);
+  ck_assert_int_eq(drpva.heading_mdeg, 315762);
+
+  // No position yet
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_drpva(&view, &drpva), LC29_NMEA_OK);
+  ck_assert_int_eq(drpva.nav_type, LC29_DR_NAV_NO_POSITION);
+  ck_assert(!drpva.has_time && !drpva.has_position && !drpva.has_velocity &&
+            !drpva.has_attitude);
+  ck_assert_uint_eq(drpva.speed_mm_s, 0);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_vehmot(&view, &vehmot),
+                   LC29_NMEA_OK);
+  ck_assert_uint_eq(vehmot.timestamp_ms, 43275714);
+  ck_assert_int_eq(vehmot.speed_mm_s, -1250);
+  ck_assert_int_eq(vehmot.acceleration_ug[0], 10000);
+  ck_assert_int_eq(vehmot.acceleration_ug[2], 999000);
+  ck_assert_int_eq(vehmot.angular_rate_udps[1], 150000);
+  ck_assert_int_eq(vehmot.angular_rate_udps[2], -2500000);
+
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_senmsg(&view, &senmsg),
+                   LC29_NMEA_OK);
+  ck_assert_int_eq(senmsg.imu_temperature_cdeg_c, 3520);
+  ck_assert_int_eq(senmsg.acceleration_ug[0], -26400);
+  ck_assert_int_eq(senmsg.angular_rate_udps[2], 500000);
+  ck_assert(senmsg.has_vehicle_speed);
+  ck_assert_uint_eq(senmsg.vehicle_speed_mm_s, 8330);
+
+  // Without vehicle speed input
+  ck_assert(lc29_framer_next(&framer, &view));
+  ck_assert_int_eq(lc29_nmea_decode_pqtm_senmsg(&view, &senmsg),
+                   LC29_NMEA_OK);
+  ck_assert_int_eq(senmsg.imu_temperature_cdeg_c, -550);
+  ck_assert(!senmsg.has_vehicle_speed);
+}
+END_TEST
+
+typedef struct {
+  int published;
+  qc_lc29x_epoch_s last;
+} epoch_log_t;
+
+static void log_epoch(void *context, const qc_lc29x_epoch_s *epoch) {
+  epoch_log_t *log = context;
+  log->published++;
+  log->last = *epoch;
+}
+
+START_TEST(test_lc29_epoch_assembler) {
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor(driverA_init, driverA_write, driverA_read_fix_rate,
+                       driverA_config);
+  static qc_lc29x_epoch_assembler_s assembler;
+  static epoch_log_t log;
+  const uint16_t every_fix = LC29_EPOCH_GGA | LC29_EPOCH_RMC | LC29_EPOCH_GSA |
+                             LC29_EPOCH_GSV | LC29_EPOCH_VTG;
+  const char *fix_1 =
+      "$GNRMC,092725.000,A,4717.113210,N,00833.915187,E,0.02,84.40,160526,,,A,"
+      "V*33\r\n"
+      "$GNVTG,84.40,T,,M,0.02,N,0.04,K,A*1D\r\n"
+      "$GNGGA,092725.000,4717.113210,N,00833.915187,E,1,08,1.01,499.617,M,"
+      "48.000,M,,*77\r\n"
+      "$GNGSA,A,3,01,02,03,05,07,,,,,,,,1.50,0.90,1.20,1*0D\r\n"
+      "$GNGSA,A,3,65,66,,,,,,,,,,,1.50,0.90,1.20,2*0F\r\n"
+      "$GPGSV,2,1,05,01,45,083,42,02,17,308,35,03,62,120,47,05,23,045,30,1*67"
+      "\r\n"
+      "$GPGSV,2,2,05,07,80,000,50,1*5B\r\n"
+      "$GNGLL,4717.113210,N,00833.915187,E,092725.000,A,A*42\r\n";
+  const char *rmc_2 =
+      "$GNRMC,092726.000,A,4717.113210,N,00833.915187,E,0.02,84.40,160526,,,A,"
+      "V*30\r\n";
+  const char *fix_2 =
+      "$GNVTG,84.40,T,,M,0.02,N,0.04,K,A*1D\r\n"
+      "$GNGGA,092726.000,4717.113210,N,00833.915187,E,1,08,1.01,499.617,M,"
+      "48.000,M,,*74\r\n"
+      "$GNGSA,A,3,01,02,03,05,07,,,,,,,,1.50,0.90,1.20,1*0D\r\n"
+      "$GNGSA,A,3,65,66,,,,,,,,,,,1.50,0.90,1.20,2*0F\r\n"
+      "$GPGSV,2,1,05,01,45,083,42,02,17,308,35,03,62,120,47,05,23,045,30,1*67"
+      "\r\n"
+      "$GPGSV,2,2,05,07,80,000,50,1*5B\r\n";
+  const char *ins =
+      "$GNGLL,4717.113210,N,00833.915187,E,092726.000,A,A*41\r\n"
+      "$PQTMINS,43275714,2,31.82072069,-117.11531216,43.364,-0.011,0.118,"
+      "0.009,1.363,-0.046,315.762*55\r\n";
+  // No VTG this time
+  const char *fix_3 =
+      "$GNRMC,092727.000,A,4717.113210,N,00833.915187,E,0.02,84.40,160526,,,A,"
+      "V*31\r\n"
+      "$GNGGA,092727.000,4717.113210,N,00833.915187,E,1,08,1.01,499.617,M,"
+      "48.000,M,,*75\r\n"
+      "$GNGSA,A,3,01,02,03,05,07,,,,,,,,1.50,0.90,1.20,1*0D\r\n"
+      "$GNGSA,A,3,65,66,,,,,,,,,,,1.50,0.90,1.20,2*0F\r\n"
+      "$GPGSV,2,1,05,01,45,083,42,02,17,308,35,03,62,120,47,05,23,045,30,1*67"
+      "\r\n"
+      "$GPGSV,2,2,05,07,80,000,50,1*5B\r\n";
+
+  lc29_epoch_init(&assembler, 0, LAT_LON_4_ALT_1, log_epoch, &log);
+  ck_assert_int_eq(lc29_epoch_attach(&assembler, driver), DRIVER_SUCCESS);
+  ck_assert_uint_eq(assembler.epoch.expected, every_fix);
+  ck_assert_int_eq(assembler.precision, LAT_LON_6_ALT_3);
+
+  // The first fix is only known to be over once the next one starts
+  lc29_driver_feed(driver, fix_1, strlen(fix_1));
+  ck_assert_int_eq(log.published, 0);
+  lc29_driver_feed(driver, rmc_2, strlen(rmc_2));
+  ck_assert_int_eq(log.published, 1);
+  ck_assert_uint_eq(log.last.parts, every_fix);
+  ck_assert(log.last.complete);
+  ck_assert_uint_eq(log.last.utc_time_ms, 34045000);
+  ck_assert_int_eq(log.last.gga.altitude_mm, 499617);
+  ck_assert_int_eq(log.last.vtg.course_cdeg, 8440);
+  ck_assert_int_eq(log.last.gsv.count, 5);
+  ck_assert_uint_eq(log.last.gsa.used[GPS], 0xAE);
+  ck_assert(log.last.gsa.used[GLONASS] != 0);
+
+  // From then on a fix goes out with its last GSV, GLL is not waited for
+  lc29_driver_feed(driver, fix_2, strlen(fix_2));
+  ck_assert_int_eq(log.published, 2);
+  ck_assert_uint_eq(log.last.utc_time_ms, 34046000);
+  ck_assert(log.last.rmc.has_date);
+  ck_assert_int_eq(log.last.gsv.count, 5);
+
+  lc29_driver_feed(driver, ins, strlen(ins));
+  lc29_driver_feed(driver, fix_3, strlen(fix_3));
+  ck_assert_int_eq(log.published, 3);
+  ck_assert(!log.last.complete);
+  ck_assert_uint_eq(log.last.parts,
+                    (every_fix & ~LC29_EPOCH_VTG) | LC29_EPOCH_INS);
+  ck_assert_int_eq(log.last.ins.solution_type, 2);
+  ck_assert_int_eq(assembler.epochs, 3);
+  ck_assert_int_eq(assembler.incomplete, 1);
+  ck_assert_int_eq(assembler.late, 0);
+  ck_assert_int_eq(assembler.errors, 0);
+
+  Lc29_driver_dtor(driver);
+}
+END_TEST
+
+START_TEST(test_lc29_query_single_read_burst) {
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor(driverA_init, driverA_write,
+                       driverA_query_min_snr_burst_response, driverA_config);
+
+  ck_assert_int_eq(lc29_driver_get_min_snr(driver), CMD_SEND_SUCCESS);
+  ck_assert_int_eq(driver->min_snr, 15);
+}
+END_TEST
+
+static void count_sentence(void *context,
+                           const qc_lc29x_sentence_view_s *sentence) {
+  (void)sentence;
+  (*(int *)context)++;
+}
+
+START_TEST(test_lc29_query_interleaved_output) {
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor(driverA_init, driverA_write,
+                       driverA_query_min_snr_interleaved, driverA_config);
+  int nmea_count = 0;
+  int pqtm_count = 0;
+
+  ck_assert_int_eq(lc29_driver_set_sentence_handler(
+                       driver, LC29_SENTENCE_NMEA, count_sentence, &nmea_count),
+                   DRIVER_SUCCESS);
+  ck_assert_int_eq(lc29_driver_set_sentence_handler(
+                       driver, LC29_SENTENCE_PQTM, count_sentence, &pqtm_count),
+                   DRIVER_SUCCESS);
+
+  // The stale ACK is skipped and the position stream reaches its handlers
+  ck_assert_int_eq(lc29_driver_get_min_snr(driver), CMD_SEND_SUCCESS);
+  ck_assert_int_eq(driver->min_snr, 15);
+  ck_assert_int_eq(nmea_count, 2);
+  ck_assert_int_eq(pqtm_count, 1);
+  ck_assert_int_eq(lc29_framer_pending(&driver->framer), 0);
+
+  // Classification of what the module sends
+  qc_lc29x_parser_s parser;
+  ck_assert_int_eq(lc29_parser_parse(&parser, "$PQTMCFGEINSMSGOK*16\r\n", 22),
+                   LC29_PARSE_SENTENCE_OK);
+  ck_assert_int_eq(
+      lc29_sentence_classify("$PQTMCFGEINSMSGOK*16\r\n", &parser.info),
+      LC29_SENTENCE_PQTM_RESPONSE);
+  ck_assert_int_eq(lc29_parser_parse(&parser, "$PAIR059,15*1E\r\n", 16),
+                   LC29_PARSE_SENTENCE_OK);
+  ck_assert_int_eq(lc29_sentence_classify("$PAIR059,15*1E\r\n", &parser.info),
+                   LC29_SENTENCE_PAIR_RESPONSE);
+}
+END_TEST
+
+static uint32_t fake_clock_ms = 0;
+
+static uint32_t fake_clock(void) { return fake_clock_ms; }
+
+typedef struct {
+  int completed;
+  int last_cmd_id;
+  qc_lc29x_ack_reponse_t results[3];
+  int value;
+} cmd_log_t;
+
+static void log_command(void *context, int cmd_id,
+                        qc_lc29x_ack_reponse_t result, const int *query_values,
+                        int num_values) {
+  cmd_log_t *log = context;
+  log->results[log->completed++] = result;
+  log->last_cmd_id = cmd_id;
+  if (num_values > 0) {
+    log->value = query_values[0];
+  }
+}
+
+START_TEST(test_lc29_pipelined_commands) {
+  qc_lc29_driver_s *driver = Lc29_driver_ctor(
+      driverA_init, driverA_write, driverA_read_pipelined_burst, driverA_config);
+  cmd_log_t log = {0};
+  char set_fix_rate[] = "$PAIR050,100*22\r\n";
+  char set_min_snr[] = "$PAIR058,15*1F\r\n";
+  char get_min_snr[] = "$PAIR059*36\r\n";
+
+  // Nothing would ever expire a lost command without a clock
+  ck_assert_int_eq(
+      lc29_driver_submit_cmd(driver, set_fix_rate, 50, log_command, &log),
+      CMD_INVALID);
+  lc29_driver_set_clock(driver, fake_clock);
+
+  // All three commands are written before anything is read back
+  ck_assert_int_eq(
+      lc29_driver_submit_cmd(driver, set_fix_rate, 50, log_command, &log),
+      CMD_SEND_SUCCESS);
+  ck_assert_int_eq(
+      lc29_driver_submit_cmd(driver, set_min_snr, 58, log_command, &log),
+      CMD_SEND_SUCCESS);
+  ck_assert_int_eq(lc29_driver_submit_query(driver, get_min_snr, 59,
+                                            PAIR_COMMON_GET_MIN_SNR,
+                                            PAIR_QUERY_MIN_SNR_NUM_ARGS,
+                                            log_command, &log),
+                   CMD_SEND_SUCCESS);
+  ck_assert_int_eq(lc29_driver_pending_cmds(driver), 3);
+
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+  ck_assert_int_eq(lc29_driver_pending_cmds(driver), 0);
+  ck_assert_int_eq(log.completed, 3);
+  ck_assert_int_eq(log.results[0], CMD_SEND_SUCCESS);
+  ck_assert_int_eq(log.results[1], CMD_SEND_SUCCESS);
+  ck_assert_int_eq(log.results[2], CMD_SEND_SUCCESS);
+  ck_assert_int_eq(log.last_cmd_id, 59);
+  ck_assert_int_eq(log.value, 15);
+}
+END_TEST
+
+START_TEST(test_lc29_pipelined_same_id) {
+  fake_uart_s uart = {.rx = "$PAIR001,063,0*3E\r\n$PAIR063,0,1*3E\r\n"
+                            "$PAIR001,063,0*3E\r\n$PAIR063,4,5*3E\r\n",
+                      .rx_pos = 0,
+                      .rx_chunk = 36};
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor_transport(&fake_uart_transport, &uart);
+  cmd_log_t gga = {0}, rmc = {0}, lost = {0};
+  char get_gga_rate[] = "$PAIR063,0*23\r\n";
+  char get_rmc_rate[] = "$PAIR063,4*27\r\n";
+  char get_min_snr[] = "$PAIR059*36\r\n";
+
+  // Both PAIR063 are in flight at once, each answer goes to the oldest
+  fake_clock_ms = 0;
+  lc29_driver_set_clock(driver, fake_clock);
+  ck_assert_int_eq(lc29_driver_submit_query(driver, get_gga_rate, 63,
+                                            PAIR_COMMON_GET_NMEA_OUTPUT_RATE,
+                                            PAIR_QUERY_NMEA_RATE_NUM_ARGS,
+                                            log_command, &gga),
+                   CMD_SEND_SUCCESS);
+  ck_assert_int_eq(lc29_driver_submit_query(driver, get_rmc_rate, 63,
+                                            PAIR_COMMON_GET_NMEA_OUTPUT_RATE,
+                                            PAIR_QUERY_NMEA_RATE_NUM_ARGS,
+                                            log_command, &rmc),
+                   CMD_SEND_SUCCESS);
+  ck_assert_int_eq(lc29_driver_pending_cmds(driver), 2);
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+  ck_assert_int_eq(gga.completed, 1);
+  ck_assert_int_eq(gga.value, NMEA_SEN_GGA);
+  ck_assert_int_eq(rmc.completed, 0);
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+  ck_assert_int_eq(rmc.completed, 1);
+  ck_assert_int_eq(rmc.results[0], CMD_SEND_SUCCESS);
+  ck_assert_int_eq(rmc.value, NMEA_SEN_RMC);
+
+  // A full table is reported by the driver, not as a module result
+  uart.tx_length = 0;
+  for (int i = 0; i < LC29_DRIVER_MAX_PENDING_CMDS; i++) {
+    ck_assert_int_eq(lc29_driver_submit_query(driver, get_min_snr, 59,
+                                              PAIR_COMMON_GET_MIN_SNR,
+                                              PAIR_QUERY_MIN_SNR_NUM_ARGS,
+                                              NULL, NULL),
+                     CMD_SEND_SUCCESS);
+    uart.tx_length = 0;
+  }
+  ck_assert_int_eq(lc29_driver_submit_query(driver, get_min_snr, 59,
+                                            PAIR_COMMON_GET_MIN_SNR,
+                                            PAIR_QUERY_MIN_SNR_NUM_ARGS,
+                                            log_command, &lost),
+                   CMD_QUEUE_FULL);
+
+  // Unanswered commands give their slots back at the ACK deadline
+  fake_clock_ms += LC29_DRIVER_ACK_TIMEOUT_MS;
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+  ck_assert_int_eq(lc29_driver_pending_cmds(driver), 0);
+  Lc29_driver_dtor(driver);
+}
+END_TEST
+
+START_TEST(test_lc29_set_split_response) {
+  qc_lc29_driver_s *driver = Lc29_driver_ctor(
+      driverA_init, driverA_write, driverA_read_fix_rate_split, driverA_config);
+  char fix_rate[] = "100";
+
+  ck_assert_int_eq(lc29_driver_set_fix_rate(driver, fix_rate),
+                   CMD_SEND_SUCCESS);
+  ck_assert_int_eq(driver->fix_rate, TEN_HZ);
+}
+END_TEST
+
+START_TEST(test_lc29_transport_context) {
+  fake_uart_s uart_a = {.rx = "$PAIR001,059,0*37\r\n$PAIR059,15*1E\r\n",
+                        .rx_pos = 0,
+                        .rx_chunk = 7};
+  fake_uart_s uart_b = {.rx = "$PAIR001,059,0*37\r\n$PAIR059,21*19\r\n",
+                        .rx_pos = 0,
+                        .rx_chunk = 64};
+  qc_lc29_driver_s *driver_a =
+      Lc29_driver_ctor_transport(&fake_uart_transport, &uart_a);
+  qc_lc29_driver_s *driver_b =
+      Lc29_driver_ctor_transport(&fake_uart_transport, &uart_b);
+
+  ck_assert_ptr_nonnull(driver_a);
+  ck_assert_ptr_nonnull(driver_b);
+  ck_assert_ptr_null(Lc29_driver_ctor_transport(NULL, &uart_a));
+
+  // Each driver only talks to its own UART
+  ck_assert_int_eq(lc29_driver_get_min_snr(driver_a), CMD_SEND_SUCCESS);
+  ck_assert_int_eq(lc29_driver_get_min_snr(driver_b), CMD_SEND_SUCCESS);
+  ck_assert_int_eq(driver_a->min_snr, 15);
+  ck_assert_int_eq(driver_b->min_snr, 21);
+  ck_assert_str_eq(uart_a.tx, "$PAIR059*36\r\n");
+  ck_assert_str_eq(uart_b.tx, "$PAIR059*36\r\n");
+
+  // Nothing left to read, a non-blocking poll returns right away
+  ck_assert_int_eq(lc29_driver_poll(driver_a), DRIVER_SUCCESS);
+  ck_assert_int_eq(lc29_driver_get_min_snr(driver_a), CMD_SEND_FAIL);
+
+  Lc29_driver_dtor(driver_a);
+  Lc29_driver_dtor(driver_b);
+}
+END_TEST
+
+START_TEST(test_lc29_static_storage) {
+  static qc_lc29x_driver_storage_t storage;
+  qc_lc29x_driver_storage_t slots[2];
+  qc_lc29x_driver_pool_s pool;
+  fake_uart_s uart = {.rx = "$PAIR001,059,0*37\r\n$PAIR059,15*1E\r\n"
+                             "$PAIR001,059,0*37\r\n$PAIR059,21*19\r\n",
+                      .rx_pos = 0,
+                      .rx_chunk = 16};
+  cmd_log_t log = {0};
+  char get_min_snr[] = "$PAIR059*36\r\n";
+
+  ck_assert_uint_le(lc29_driver_size(), sizeof(storage));
+  ck_assert_uint_eq((uintptr_t)&storage % lc29_driver_alignment(), 0);
+  ck_assert_ptr_null(Lc29_driver_ctor_static(
+      &storage, lc29_driver_size() - 1, &fake_uart_transport, &uart));
+  ck_assert_ptr_null(Lc29_driver_ctor_static(
+      &storage.bytes[1], sizeof(storage) - 1, &fake_uart_transport, &uart));
+
+  // Nothing below may reach the heap, results are checked afterwards
+  size_t heap_calls = driver_heap_calls;
+  qc_lc29_driver_s *driver = Lc29_driver_ctor_static(
+      &storage, sizeof(storage), &fake_uart_transport, &uart);
+  qc_lc29x_ack_reponse_t blocking = lc29_driver_get_min_snr(driver);
+  uint16_t min_snr = driver->min_snr;
+  lc29_driver_set_clock(driver, fake_clock);
+  qc_lc29x_ack_reponse_t submitted = lc29_driver_submit_query(
+      driver, get_min_snr, 59, PAIR_COMMON_GET_MIN_SNR,
+      PAIR_QUERY_MIN_SNR_NUM_ARGS, log_command, &log);
+  while (lc29_driver_pending_cmds(driver) > 0 &&
+         uart.rx_pos < strlen(uart.rx)) {
+    lc29_driver_poll(driver);
+  }
+  Lc29_driver_dtor(driver);
+
+  size_t capacity = lc29_driver_pool_init(&pool, slots, 2);
+  qc_lc29_driver_s *first =
+      Lc29_driver_pool_ctor(&pool, &fake_uart_transport, &uart);
+  qc_lc29_driver_s *second =
+      Lc29_driver_pool_ctor(&pool, &fake_uart_transport, &uart);
+  qc_lc29_driver_s *exhausted =
+      Lc29_driver_pool_ctor(&pool, &fake_uart_transport, &uart);
+  Lc29_driver_dtor(first);
+  qc_lc29_driver_s *reused =
+      Lc29_driver_pool_ctor(&pool, &fake_uart_transport, &uart);
+  size_t available = pool.available;
+  Lc29_driver_dtor(second);
+  Lc29_driver_dtor(reused);
+  Lc29_driver_dtor(reused); // released twice, ignored
+  qc_lc29_driver_s *again[3];
+  for (int i = 0; i < 3; i++) {
+    again[i] = Lc29_driver_pool_ctor(&pool, &fake_uart_transport, &uart);
+  }
+  size_t drained = pool.available;
+  for (int i = 0; i < 3; i++) {
+    Lc29_driver_dtor(again[i]);
+  }
+  heap_calls = driver_heap_calls - heap_calls;
+
+  ck_assert_ptr_eq(driver, (qc_lc29_driver_s *)&storage);
+  ck_assert_int_eq(blocking, CMD_SEND_SUCCESS);
+  ck_assert_int_eq(min_snr, 15);
+  ck_assert_int_eq(submitted, CMD_SEND_SUCCESS);
+  ck_assert_int_eq(log.completed, 1);
+  ck_assert_int_eq(log.value, 21);
+
+  ck_assert_uint_eq(capacity, 2);
+  ck_assert_ptr_eq(first, (qc_lc29_driver_s *)&slots[0]);
+  ck_assert_ptr_eq(second, (qc_lc29_driver_s *)&slots[1]);
+  ck_assert_ptr_null(exhausted);
+  ck_assert_ptr_eq(reused, first);
+  ck_assert_uint_eq(available, 0);
+  ck_assert_uint_eq(pool.available, 2);
+  ck_assert_ptr_nonnull(again[0]);
+  ck_assert_ptr_nonnull(again[1]);
+  ck_assert_ptr_ne(again[0], again[1]);
+  ck_assert_ptr_null(again[2]);
+  ck_assert_uint_eq(drained, 0);
+#ifdef LC29_TESTS_WRAP_MALLOC
+  ck_assert_uint_eq(heap_calls, 0);
+#endif
+}
+END_TEST
+
+#ifdef __linux__
+START_TEST(test_lc29_linux_serial_pty) {
+  int master, slave;
+  qc_lc29x_linux_serial_s serial;
+  char module_output[] = "$PAIR001,059,0*37\r\n$PAIR059,15*1E\r\n";
+  char command[32] = {0};
+  int nmea_count = 0;
+
+  ck_assert_int_eq(open_pty_pair(&master, &slave), 0);
+  ck_assert_int_eq(lc29_linux_serial_attach(&serial, slave, 115200),
+                   DRIVER_SUCCESS);
+  ck_assert(!serial.low_latency); // ptys have no serial_struct
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor_transport(&lc29_linux_serial_transport, &serial);
+
+  // Command round-trip, the answer is already waiting in the tty
+  ck_assert_int_eq(write(master, module_output, strlen(module_output)),
+                   (ssize_t)strlen(module_output));
+  ck_assert_int_eq(lc29_driver_get_min_snr(driver), CMD_SEND_SUCCESS);
+  ck_assert_int_eq(driver->min_snr, 15);
+  ck_assert_int_gt(read(master, command, sizeof(command) - 1), 0);
+  ck_assert_str_eq(command, "$PAIR059*36\r\n");
+
+  // A burst of output is drained into the handlers in one call
+  char gga[] = "$GNGGA,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,"
+               "46.9,M,,*77\r\n";
+  lc29_driver_set_sentence_handler(driver, LC29_SENTENCE_NMEA, count_sentence,
+                                   &nmea_count);
+  ck_assert_int_eq(lc29_linux_serial_poll(&serial, driver, 0), 0);
+  for (int i = 0; i < 5; i++) {
+    ck_assert_int_eq(write(master, gga, strlen(gga)), (ssize_t)strlen(gga));
+  }
+  ck_assert_int_eq(lc29_linux_serial_poll(&serial, driver, 1000),
+                   5 * (int)strlen(gga));
+  ck_assert_int_eq(nmea_count, 5);
+
+  // Nothing pending, a non-blocking read comes back empty
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+
+  lc29_linux_serial_close(&serial);
+  close(slave);
+  close(master);
+  Lc29_driver_dtor(driver);
 }
 END_TEST
 
+START_TEST(test_lc29_linux_fleet) {
+  qc_lc29x_fleet_member_s members[3];
+  qc_lc29x_driver_storage_t slots[3];
+  qc_lc29x_fleet_s fleet;
+  int masters[3], slaves[3], counts[3] = {0};
+  cmd_log_t log = {0};
+  char get_min_snr[] = "$PAIR059*36\r\n";
+  char gga[] = "$GNGGA,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,"
+               "46.9,M,,*77\r\n";
+
+  // Without storage for the drivers nothing is left open
+  ck_assert_int_eq(lc29_fleet_init(&fleet, members, NULL, 3), DRIVCER_FAIL);
+  ck_assert_int_eq(fleet.epoll_fd, -1);
+
+  size_t heap_calls = driver_heap_calls;
+  ck_assert_int_eq(lc29_fleet_init(&fleet, members, slots, 3), DRIVER_SUCCESS);
+  for (int i = 0; i < 3; i++) {
+    ck_assert_int_eq(open_pty_pair(&masters[i], &slaves[i]), 0);
+    ck_assert_int_eq(lc29_fleet_add(&fleet, slaves[i], 115200), i);
+    lc29_driver_set_sentence_handler(lc29_fleet_driver(&fleet, i),
+                                     LC29_SENTENCE_NMEA, count_sentence,
+                                     &counts[i]);
+  }
+  ck_assert_int_eq(lc29_fleet_add(&fleet, slaves[0], 115200), -1);
+#ifdef LC29_TESTS_WRAP_MALLOC
+  ck_assert_uint_eq(driver_heap_calls - heap_calls, 0);
+#endif
+  ck_assert_ptr_eq(lc29_fleet_driver(&fleet, 0), (qc_lc29_driver_s *)&slots[0]);
+
+  // Output of every module ends up in its own driver
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j <= i; j++) {
+      ck_assert_int_eq(write(masters[i], gga, strlen(gga)),
+                       (ssize_t)strlen(gga));
+    }
+  }
+  while (counts[0] + counts[1] + counts[2] < 6) {
+    ck_assert_int_gt(lc29_fleet_run_once(&fleet, 1000), 0);
+  }
+  ck_assert_int_eq(counts[0], 1);
+  ck_assert_int_eq(counts[1], 2);
+  ck_assert_int_eq(counts[2], 3);
+  // Members are only waited on through the fleet's epoll
+  for (int i = 0; i < 3; i++) {
+    ck_assert_int_eq(members[i].serial.epoll_fd, -1);
+  }
+
+  // A command submitted on one member completes from the loop
+  ck_assert_int_eq(lc29_driver_submit_query(
+                       lc29_fleet_driver(&fleet, 1), get_min_snr, 59,
+                       PAIR_COMMON_GET_MIN_SNR, PAIR_QUERY_MIN_SNR_NUM_ARGS,
+                       log_command, &log),
+                   CMD_SEND_SUCCESS);
+  char answer[] = "$PAIR001,059,0*37\r\n$PAIR059,15*1E\r\n";
+  ck_assert_int_eq(write(masters[1], answer, strlen(answer)),
+                   (ssize_t)strlen(answer));
+  while (log.completed == 0) {
+    ck_assert_int_gt(lc29_fleet_run_once(&fleet, 1000), 0);
+  }
+  ck_assert_int_eq(log.results[0], CMD_SEND_SUCCESS);
+  ck_assert_int_eq(log.value, 15);
+
+  // A module that hangs up is dropped from the fleet
+  close(masters[2]);
+  ck_assert_int_gt(lc29_fleet_run_once(&fleet, 1000), 0);
+  ck_assert_ptr_null(lc29_fleet_driver(&fleet, 2));
+  ck_assert_int_eq(fleet.count, 2);
+
+  lc29_fleet_close(&fleet);
+  for (int i = 0; i < 3; i++) {
+    close(slaves[i]);
+  }
+  close(masters[0]);
+  close(masters[1]);
+}
+END_TEST
+#endif
+
 /*
  *
  *   LC29 Driver Setter Methods Tests
@@ -139,6 +1445,259 @@ START_TEST(test_lc29_set_static_speed_threshold) {
 }
 END_TEST
 
+START_TEST(test_lc29_constant_frames) {
+  // Documented examples
+  const char *examples[][2] = {
+      {"$PAIR002*38\r\n", "GNSS power on"},
+      {"$PAIR003*39\r\n", "GNSS power off"},
+      {"$PAIR004*3E\r\n", "hot start"},
+      {"$PAIR005*3F\r\n", "warm start"},
+      {"$PAIR006*3C\r\n", "cold start"},
+      {"$PAIR007*3D\r\n", "full cold start"},
+      {"$PAIR513*3D\r\n", "NVM save"},
+      {"$PAIR051*3E\r\n", "get fix rate"},
+      {"$PAIR059*36\r\n", "get min SNR"},
+      {"$PAIR067*3B\r\n", "get search mode"},
+      {"$PAIR071*3C\r\n", "get static threshold"},
+      {"$PAIR081*33\r\n", "get navigation mode"},
+      {"$PAIR099*3A\r\n", "get decimal precision"},
+      {"$PAIR101*3A\r\n", "get NMEA output mode"},
+      {"$PAIR105*3E\r\n", "get dual band"},
+      {"$PAIR411*3E\r\n", "get SBAS"},
+      {"$PAIR491*36\r\n", "get EASY"},
+      {"$PAIR865,0,0*31\r\n", "get baud rate"},
+      {"$PQTMSAVEPAR*5A\r\n", "DR save"},
+      {"$PQTMCFGEINSMSG,0*0E\r\n", "get PQTM output"},
+  };
+  const qc_lc29x_frame_id_t example_ids[] = {
+      LC29_FRAME_GNSS_POWER_ON,
+      LC29_FRAME_GNSS_POWER_OFF,
+      LC29_FRAME_HOT_START,
+      LC29_FRAME_WARM_START,
+      LC29_FRAME_COLD_START,
+      LC29_FRAME_FULL_COLD_START,
+      LC29_FRAME_NVM_SAVE_SETTING,
+      LC29_FRAME_GET_FIX_RATE,
+      LC29_FRAME_GET_MIN_SNR,
+      LC29_FRAME_GET_GNSS_SEARCH_MODE,
+      LC29_FRAME_GET_STATIC_THRESHOLD,
+      LC29_FRAME_GET_NAVIGATION_MODE,
+      LC29_FRAME_GET_NMEA_POS_DECIMAL_PRECISION,
+      LC29_FRAME_GET_NMEA_OUTPUT_MODE,
+      LC29_FRAME_GET_DUAL_BAND,
+      LC29_FRAME_GET_SBAS_STATUS,
+      LC29_FRAME_GET_EASY_STATUS,
+      LC29_FRAME_GET_UART0_BAUDRATE,
+      LC29_FRAME_DR_SAVE_SETTINGS,
+      LC29_FRAME_DR_GET_PQTM_MESSAGE_CONFIG,
+  };
+  // One example per frame
+  ck_assert_uint_eq(sizeof(example_ids) / sizeof(example_ids[0]),
+                    LC29_FRAME_COUNT);
+  ck_assert_uint_eq(sizeof(examples) / sizeof(examples[0]), LC29_FRAME_COUNT);
+  for (size_t i = 0; i < sizeof(example_ids) / sizeof(example_ids[0]); i++) {
+    ck_assert_msg(0 == strcmp(lc29_command_frames[example_ids[i]].data,
+                              examples[i][0]),
+                  "%s", examples[i][1]);
+  }
+
+  // Every frame is well formed, the serializer agrees on its checksum
+  for (int id = 0; id < LC29_FRAME_COUNT; id++) {
+    const qc_lc29x_frame_s *frame = &lc29_command_frames[id];
+    char header[LC29_CMD_MAX_LENGTH];
+    char built[LC29_CMD_MAX_LENGTH];
+    qc_lc29x_command_s command;
+    size_t header_length = frame->length - 5; // *hh<CR><LF>
+
+    ck_assert_ptr_nonnull(frame->data);
+    ck_assert_uint_eq(frame->length, strlen(frame->data));
+    memcpy(header, frame->data, header_length);
+    header[header_length] = '\0';
+    lc29_command_begin(&command, built, sizeof(built), header);
+    ck_assert_uint_eq(lc29_command_end(&command), frame->length);
+    ck_assert_str_eq(built, frame->data);
+
+    if (0 == strncmp(frame->data, PAIR_CMD_PREFIX, 5)) {
+      ck_assert_int_eq(frame->cmd_id, atoi(&frame->data[5]));
+    } else {
+      ck_assert_int_eq(frame->cmd_id, -1);
+    }
+  }
+
+  // PQTM frames are written without waiting for an answer
+  fake_uart_s uart = {.rx = "", .rx_pos = 0, .rx_chunk = 64};
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor_transport(&fake_uart_transport, &uart);
+  ck_assert_int_eq(
+      lc29_driver_send_constant(driver, LC29_FRAME_DR_SAVE_SETTINGS),
+      CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PQTMSAVEPAR*5A\r\n");
+  ck_assert_int_eq(lc29_driver_submit_constant(driver,
+                                               LC29_FRAME_DR_SAVE_SETTINGS,
+                                               NULL, 0, NULL, NULL),
+                   CMD_INVALID);
+  ck_assert_int_eq(lc29_driver_send_constant(driver, LC29_FRAME_COUNT),
+                   CMD_INVALID);
+  Lc29_driver_dtor(driver);
+}
+END_TEST
+
+START_TEST(test_lc29_typed_setters) {
+  fake_uart_s uart = {.rx = "$PAIR001,050,0*3E\r\n$PAIR001,864,0*31\r\n"
+                             "$PAIR001,062,0*3F\r\n",
+                      .rx_pos = 0,
+                      .rx_chunk = 19}; // one ACK per read
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor_transport(&fake_uart_transport, &uart);
+
+  ck_assert_int_eq(lc29_driver_set_fix_interval(driver, 200),
+                   CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PAIR050,200*21\r\n");
+  ck_assert_int_eq(lc29_driver_fix_interval(driver), 200);
+
+  uart.tx_length = 0;
+  ck_assert_int_eq(lc29_driver_set_uart_baud_rate(driver, 0, 9600),
+                   CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PAIR864,0,0,9600*13\r\n");
+  ck_assert_int_eq(driver->baud_rate, LC29_BAUD_RATE_9600);
+
+  uart.tx_length = 0;
+  ck_assert_int_eq(
+      lc29_driver_set_nmea_output_interval(driver, NMEA_SEN_RMC, 5),
+      CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PAIR062,4,5*3F\r\n");
+  ck_assert_int_eq(driver->nmea_output_rate.rmc.output_rate, 5);
+
+  // Out of range values are refused before anything is written
+  uart.tx_length = 0;
+  uart.tx[0] = '\0';
+  ck_assert_int_eq(lc29_driver_set_fix_interval(driver, 99), CMD_INVALID);
+  ck_assert_int_eq(lc29_driver_set_min_snr_dbhz(driver, 8), CMD_INVALID);
+  ck_assert_int_eq(lc29_driver_set_uart_baud_rate(driver, 0, 12345),
+                   CMD_INVALID);
+  ck_assert_int_eq(lc29_driver_set_pqtm_message_output(driver, true, true,
+                                                       true, 3),
+                   CMD_INVALID);
+  ck_assert_int_eq(lc29_driver_set_navigation_mode(driver, RESERVED_2),
+                   CMD_INVALID);
+  ck_assert_int_eq(lc29_driver_set_fix_rate(driver, "100ms"), CMD_INVALID);
+  ck_assert_int_eq(lc29_driver_set_min_snr(driver, "-15"), CMD_INVALID);
+  ck_assert_uint_eq(uart.tx_length, 0);
+
+  Lc29_driver_dtor(driver);
+}
+END_TEST
+
+START_TEST(test_lc29_command_registry) {
+  // Every entry is consistent with its header and frame
+  for (int cmd = 0; cmd < LC29_PAIR_CMD_COUNT; cmd++) {
+    const qc_lc29x_pair_cmd_desc_s *desc = &lc29_pair_cmds[cmd];
+    uint8_t kept_from = desc->query_num_args > 0 ? desc->query_num_args
+                                                 : desc->num_args;
+
+    ck_assert_ptr_nonnull(desc->header);
+    if (0 == strncmp(desc->header, PAIR_CMD_PREFIX, 5)) {
+      ck_assert_int_eq(desc->cmd_id, atoi(&desc->header[5]));
+    } else {
+      ck_assert_int_eq(desc->cmd_id, -1);
+    }
+    ck_assert_uint_le(desc->num_args, LC29_PAIR_MAX_ARGS);
+    ck_assert_uint_le(desc->query_num_args, PAIR_QUERY_MAX_ARGS);
+    ck_assert_uint_le(desc->query_min_args, desc->query_num_args);
+    ck_assert_uint_le(desc->state_first + desc->state_count, kept_from);
+    ck_assert_uint_le(desc->state_offset + desc->state_size,
+                      sizeof(qc_lc29_driver_s));
+    if (desc->frame != LC29_FRAME_COUNT) {
+      ck_assert_uint_eq(desc->num_args, 0);
+      ck_assert_int_eq(lc29_command_frames[desc->frame].cmd_id, desc->cmd_id);
+    }
+  }
+
+  fake_uart_s uart = {
+      .rx = "$PAIR001,067,0*3A\r\n$PAIR067,1,0,1,1,0,0*3A\r\n",
+      .rx_pos = 0,
+      .rx_chunk = 64};
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor_transport(&fake_uart_transport, &uart);
+
+  // All six values of the search mode are read back
+  ck_assert_int_eq(lc29_driver_get_gnss_search_mode(driver), CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PAIR067*3B\r\n");
+  ck_assert(driver->gnss_search_mode.gps_enabled);
+  ck_assert(!driver->gnss_search_mode.glonass_enabled);
+  ck_assert(driver->gnss_search_mode.galileo_enabled);
+  ck_assert(driver->gnss_search_mode.beidou_enabled);
+  ck_assert(!driver->gnss_search_mode.qzss_enabled);
+
+  // The sentence type is sent and selects the rate that is kept
+  uart.rx = "$PAIR001,063,0*3E\r\n$PAIR063,4,3*38\r\n";
+  uart.rx_pos = 0;
+  uart.tx_length = 0;
+  ck_assert_int_eq(lc29_driver_get_nmea_output_rate(driver, "4"),
+                   CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PAIR063,4*27\r\n");
+  ck_assert_int_eq(driver->nmea_output_rate.rmc.output_rate, 3);
+
+  // A result for a sentence type that does not exist is refused
+  uart.rx = "$PAIR001,063,0*3E\r\n$PAIR063,7,3*3B\r\n";
+  uart.rx_pos = 0;
+  uart.tx_length = 0;
+  ck_assert_int_eq(lc29_driver_get_nmea_output_rate(driver, "4"),
+                   CMD_SEND_FAIL);
+  ck_assert_int_eq(lc29_driver_get_nmea_output_rate(driver, "-1"),
+                   CMD_INVALID);
+
+  // A result for another sentence type than the requested one is refused
+  uart.rx = "$PAIR001,063,0*3E\r\n$PAIR063,2,3*3E\r\n";
+  uart.rx_pos = 0;
+  uart.tx_length = 0;
+  driver->nmea_output_rate.gsa.output_rate = 1;
+  ck_assert_int_eq(lc29_driver_get_nmea_output_rate(driver, "4"),
+                   CMD_SEND_FAIL);
+  ck_assert_int_eq(driver->nmea_output_rate.gsa.output_rate, 1);
+  ck_assert_int_eq(driver->nmea_output_rate.rmc.output_rate, 3);
+
+  uart.rx = "$PAIR001,101,0*3B\r\n$PAIR101,2,1*39\r\n";
+  uart.rx_pos = 0;
+  uart.tx_length = 0;
+  ck_assert_int_eq(lc29_driver_get_nmea_output_mode(driver), CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PAIR101*3A\r\n");
+  ck_assert_int_eq(driver->nmea_output_mode, ENABLE_ASCII_NMEA_3_01);
+
+  // A PQTM GET sends only <Type> and keeps the query result
+  uart.rx = "$PQTMCFGEINSMSGOK*16\r\n$PQTMEINSMSG,0,1,0,1,20*7E\r\n";
+  uart.rx_pos = 0;
+  uart.tx_length = 0;
+  ck_assert_int_eq(lc29_driver_set_get_pqtm_message_settings(
+                       driver, false, false, false, false, "1"),
+                   CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PQTMCFGEINSMSG,0*0E\r\n");
+  ck_assert(driver->dr_rtk_output_rate.ins.enabled);
+  ck_assert(!driver->dr_rtk_output_rate.imu.enabled);
+  ck_assert_int_eq(driver->dr_rtk_output_rate.imu.fix_rate, 20);
+  ck_assert_int_eq(driver->dr_rtk_output_rate.gps.fix_rate, 10);
+
+  // A SET is checked against the listed rates, ERROR leaves the state alone
+  uart.rx = "$PQTMCFGEINSMSGERROR*4A\r\n";
+  uart.rx_pos = 0;
+  uart.tx_length = 0;
+  ck_assert_int_eq(lc29_driver_set_pqtm_message_output(driver, false, true,
+                                                       true, 30),
+                   CMD_INVALID);
+  ck_assert_uint_eq(uart.tx_length, 0);
+  ck_assert_int_eq(lc29_driver_set_pqtm_message_output(driver, false, true,
+                                                       true, 50),
+                   CMD_SEND_FAIL);
+  ck_assert_str_eq(uart.tx, "$PQTMCFGEINSMSG,1,0,1,1,50*3A\r\n");
+  ck_assert(driver->dr_rtk_output_rate.ins.enabled);
+  ck_assert_int_eq(driver->dr_rtk_output_rate.imu.fix_rate, 20);
+
+  ck_assert_int_eq(lc29_driver_execute(driver, LC29_PAIR_CMD_COUNT, NULL),
+                   CMD_INVALID);
+  Lc29_driver_dtor(driver);
+}
+END_TEST
+
 START_TEST(test_lc29_set_nav_mode) {
   // TODO
 }
@@ -159,6 +1718,35 @@ START_TEST(test_lc29_set_dual_band_mode) {
 }
 END_TEST
 
+START_TEST(test_lc29_get_easy_status) {
+  fake_uart_s uart = {.rx = "$PAIR001,491,0*37\r\n$PAIR491,1,2*35\r\n",
+                      .rx_pos = 0,
+                      .rx_chunk = 64};
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor_transport(&fake_uart_transport, &uart);
+
+  // <Enable>,<Status> while EASY is enabled
+  ck_assert_int_eq(lc29_driver_get_easy_satus(driver), CMD_SEND_SUCCESS);
+  ck_assert_str_eq(uart.tx, "$PAIR491*36\r\n");
+  ck_assert(driver->easy_enable);
+  ck_assert_int_eq(driver->easy_status, FINISHED_1_DAY);
+
+  // Only <Enable> once it is disabled, the last status is left alone
+  uart.rx = "$PAIR001,491,0*37\r\n$PAIR491,0*2A\r\n";
+  uart.rx_pos = 0;
+  ck_assert_int_eq(lc29_driver_get_easy_satus(driver), CMD_SEND_SUCCESS);
+  ck_assert(!driver->easy_enable);
+  ck_assert_int_eq(driver->easy_status, FINISHED_1_DAY);
+
+  // A third value is not part of the result
+  uart.rx = "$PAIR001,491,0*37\r\n$PAIR491,1,2,3*2A\r\n";
+  uart.rx_pos = 0;
+  ck_assert_int_eq(lc29_driver_get_easy_satus(driver), CMD_SEND_FAIL);
+  ck_assert(!driver->easy_enable);
+  Lc29_driver_dtor(driver);
+}
+END_TEST
+
 START_TEST(test_lc29_set_sbas_mode) {
   // TODO
 }
@@ -170,7 +1758,35 @@ START_TEST(test_lc29_set_easy_status) {
 END_TEST
 
 START_TEST(test_lc29_set_nvm_save_setting) {
-  // TODO
+  qc_lc29_driver_s *driver =
+      Lc29_driver_ctor(driverA_init, driverA_write,
+                       driverA_read_nvm_save_deferred, driverA_config);
+
+  // Result 1 keeps the command in flight until the final ACK
+  ck_assert_int_eq(lc29_driver_nvm_save_setting(driver, true),
+                   CMD_SEND_SUCCESS);
+  ck_assert_int_eq(lc29_driver_pending_cmds(driver), 0);
+
+  // Without a final ACK the command expires at its processing deadline
+  driver = Lc29_driver_ctor(driverA_init, driverA_write,
+                            driverA_read_processing_ack, driverA_config);
+  cmd_log_t log = {0};
+  char nvm_save[] = "$PAIR513*3D\r\n";
+  fake_clock_ms = UINT32_MAX - 100; // deadlines survive a clock wrap
+  lc29_driver_set_clock(driver, fake_clock);
+  ck_assert_int_eq(
+      lc29_driver_submit_cmd(driver, nvm_save, 513, log_command, &log),
+      CMD_SEND_SUCCESS);
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+  ck_assert_int_eq(log.completed, 0);
+  fake_clock_ms += LC29_DRIVER_PROCESSING_TIMEOUT_MS - 1;
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+  ck_assert_int_eq(log.completed, 0);
+  fake_clock_ms += 1;
+  ck_assert_int_eq(lc29_driver_poll(driver), DRIVER_SUCCESS);
+  ck_assert_int_eq(log.completed, 1);
+  ck_assert_int_eq(log.results[0], COMAND_BEING_PROCESSED);
+  ck_assert_int_eq(lc29_driver_pending_cmds(driver), 0);
 }
 END_TEST
 
@@ -274,9 +1890,15 @@ START_TEST(test_lc29_pqtm_get_method) {
   qc_lc29_driver_s *driver = Lc29_driver_ctor(
       driverA_init, driverA_write, driverA_query_pqtm_settings, driverA_config);
 
+  // The query result is stored, not the arguments of the request
   ck_assert_int_eq(lc29_driver_set_get_pqtm_message_settings(
-                       driver, false, true, true, true, "10"),
+                       driver, false, false, false, false, "5"),
                    CMD_SEND_SUCCESS);
+  ck_assert(driver->dr_rtk_output_rate.ins.enabled);
+  ck_assert(driver->dr_rtk_output_rate.imu.enabled);
+  ck_assert(driver->dr_rtk_output_rate.gps.enabled);
+  ck_assert_int_eq(driver->dr_rtk_output_rate.imu.fix_rate, 10);
+  ck_assert_int_eq(driver->dr_rtk_output_rate.gps.fix_rate, 10);
 }
 END_TEST
 
@@ -302,18 +1924,50 @@ Suite *str_suite(void) {
   tc_core = tcase_create("Core");
   tcase_add_test(tc_core, test_lc29driver_construct);
   tcase_add_test(tc_core, test_lc29_driver_parse_response);
+  tcase_add_test(tc_core, test_lc29_driver_parse_reentrant);
   tcase_add_test(tc_core, test_lc29_driver_validate_string);
   tcase_add_test(tc_core, test_lc29_driver_pair_cmd_builder);
+  tcase_add_test(tc_core, test_lc29_command_serializer);
+  tcase_add_test(tc_core, test_lc29_framer_split_and_merged_chunks);
+  tcase_add_test(tc_core, test_lc29_framer_ring_wrap);
+  tcase_add_test(tc_core, test_lc29_sentence_id_hash);
+  tcase_add_test(tc_core, test_lc29_scan_kernels);
+  tcase_add_test(tc_core, test_lc29_parser_incremental);
+  tcase_add_test(tc_core, test_lc29_sentence_field_accessors);
+  tcase_add_test(tc_core, test_lc29_nmea_gga);
+  tcase_add_test(tc_core, test_lc29_nmea_rmc_vtg);
+  tcase_add_test(tc_core, test_lc29_nmea_gsv_table);
+  tcase_add_test(tc_core, test_lc29_nmea_gsa_used_satellites);
+  tcase_add_test(tc_core, test_lc29_nmea_pqtm_dr_output);
+  tcase_add_test(tc_core, test_lc29_nmea_pqtm_dr_messages);
+  tcase_add_test(tc_core, test_lc29_epoch_assembler);
+  tcase_add_test(tc_core, test_lc29_query_single_read_burst);
+  tcase_add_test(tc_core, test_lc29_query_interleaved_output);
+  tcase_add_test(tc_core, test_lc29_set_split_response);
+  tcase_add_test(tc_core, test_lc29_pipelined_commands);
+  tcase_add_test(tc_core, test_lc29_pipelined_same_id);
+  tcase_add_test(tc_core, test_lc29_set_nvm_save_setting);
+  tcase_add_test(tc_core, test_lc29_transport_context);
+  tcase_add_test(tc_core, test_lc29_static_storage);
+#ifdef __linux__
+  tcase_add_test(tc_core, test_lc29_linux_serial_pty);
+  tcase_add_test(tc_core, test_lc29_linux_fleet);
+#endif
   tcase_add_test(tc_core, test_lc29_fix_rate_methods);
   tcase_add_test(tc_core, test_lc29_min_snr_methods);
   tcase_add_test(tc_core, test_lc29_nmea_set_output_rate_methods);
   tcase_add_test(tc_core, test_lc29_nmea_search_mode_methods);
   tcase_add_test(tc_core, test_lc29_set_static_speed_threshold);
+  tcase_add_test(tc_core, test_lc29_typed_setters);
+  tcase_add_test(tc_core, test_lc29_constant_frames);
+  tcase_add_test(tc_core, test_lc29_command_registry);
+  tcase_add_test(tc_core, test_lc29_get_easy_status);
   tcase_add_test(tc_core, test_lc29_query_parser);
   tcase_add_test(tc_core, test_lc29_query_fix_rate);
   tcase_add_test(tc_core, test_lc29_query_min_snr);
   tcase_add_test(tc_core, test_lc29_dr_parser);
   tcase_add_test(tc_core, test_lc29_pqtm_set_method);
+  tcase_add_test(tc_core, test_lc29_pqtm_get_method);
   tcase_add_test(tc_core, test_lc29_pqtm_dr_rtk_message_output_set_method);
   suite_add_tcase(s, tc_core);
 
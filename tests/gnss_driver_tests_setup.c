@@ -1,6 +1,13 @@
+#define _GNU_SOURCE
+
 #include "gnss_driver_tests.h"
 #include <stdio.h>
 #include <string.h>
+#ifdef __linux__
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
 
 qc_lc29x_driver_response_t driverA_init(void) {
   // Initialization code for Microcontroller A (random things being returned)
@@ -37,6 +44,17 @@ qc_lc29x_driver_response_t driverA_query_fix_rate_response(char *data,
   }
 }
 
+qc_lc29x_driver_response_t driverA_read_fix_rate_split(char *data,
+                                                       int length) {
+  // The ACK shows up over three reads
+  static int response_state = 0;
+  const char *test_response[] = {"$PAIR00", "1,050,0*", "3E\r\n"};
+
+  strcpy(data, test_response[response_state]);
+  response_state = (response_state + 1) % 3;
+  return DRIVER_SUCCESS;
+}
+
 qc_lc29x_driver_response_t driverA_read_min_snr(char *data, int length) {
   // Read data from Microcontroller A (random things being returned)
   char test_response[] = "$PAIR001,058,0*36\n\r";
@@ -61,6 +79,59 @@ qc_lc29x_driver_response_t driverA_query_min_snr_response(char *data,
   }
 }
 
+qc_lc29x_driver_response_t driverA_query_min_snr_burst_response(char *data,
+                                                                int length) {
+  // ACK and query result delivered by a single read
+  char test_response[] = "$PAIR001,059,0*37\r\n$PAIR059,15*1E\r\n";
+  strcpy(data, test_response);
+  return DRIVER_SUCCESS;
+}
+
+qc_lc29x_driver_response_t driverA_query_min_snr_interleaved(char *data,
+                                                             int length) {
+  // Live output and a stale ACK around the expected ACK and query result
+  static int response_state = 0;
+  const char *test_response[] = {
+      "$PAIR001,050,0*3E\r\n$GNGGA,123519.00,4807.038,N,01131.000,E,1,08,"
+      "0.9,545.4,M,46.9,M,,*77\r\n$PAIR001,059,0*37\r\n$GNRMC,123519.00,A,",
+      "4807.038,N,01131.000,E,0.02,84.4,230394,,,A,V*30\r\n$PQTMINS,1,"
+      "123519000,1,48.117300,11.516667,545.4,0.1,0.0,0.0,0.5,1.2,84.4*6D\r\n"
+      "$PAIR059,15*1E\r\n"};
+
+  strcpy(data, test_response[response_state]);
+  response_state = (response_state + 1) % 2;
+  return DRIVER_SUCCESS;
+}
+
+qc_lc29x_driver_response_t driverA_read_pipelined_burst(char *data,
+                                                        int length) {
+  // ACKs of three back-to-back commands and the query result in one read
+  char test_response[] = "$PAIR001,050,0*3E\r\n$PAIR001,058,0*36\r\n"
+                         "$PAIR001,059,0*37\r\n$PAIR059,15*1E\r\n";
+  strcpy(data, test_response);
+  return DRIVER_SUCCESS;
+}
+
+qc_lc29x_driver_response_t driverA_read_nvm_save_deferred(char *data,
+                                                          int length) {
+  // Result 1 first, the final ACK only shows up a few reads later
+  static int response_state = 0;
+  const char *test_response[] = {"$PAIR001,513,1*3D\r\n", "", "",
+                                 "$PAIR001,513,0*3C\r\n"};
+
+  strcpy(data, test_response[response_state]);
+  response_state = (response_state + 1) % 4;
+  return DRIVER_SUCCESS;
+}
+
+qc_lc29x_driver_response_t driverA_read_processing_ack(char *data,
+                                                       int length) {
+  // The module never gets past result 1
+  char test_response[] = "$PAIR001,513,1*3D\r\n";
+  strcpy(data, test_response);
+  return DRIVER_SUCCESS;
+}
+
 qc_lc29x_driver_response_t driverA_read_nmea_output_rate(char *data,
                                                          int length) {
   // Read data from Microcontroller A (random things being returned)
@@ -132,4 +203,82 @@ qc_lc29x_driver_response_t driverA_config(char config) {
   // Configure Microcontroller A (random things being returned)
 
   return DRIVER_SUCCESS;
-}
\ No newline at end of file
+}
+
+static int fake_uart_write(void *ctx, const char *data, size_t length,
+                           int timeout_ms) {
+  fake_uart_s *uart = ctx;
+  // Accept at most 8 bytes per call like a small TX FIFO would
+  size_t written = length > 8 ? 8 : length;
+
+  if (uart->tx_length + written >= sizeof(uart->tx)) {
+    return -1;
+  }
+  memcpy(&uart->tx[uart->tx_length], data, written);
+  uart->tx_length += written;
+  uart->tx[uart->tx_length] = '\0';
+  return (int)written;
+}
+
+static int fake_uart_read(void *ctx, char *data, size_t length,
+                          int timeout_ms) {
+  fake_uart_s *uart = ctx;
+  size_t available = strlen(uart->rx) - uart->rx_pos;
+  size_t count = available < uart->rx_chunk ? available : uart->rx_chunk;
+
+  if (count > length) {
+    count = length;
+  }
+  memcpy(data, &uart->rx[uart->rx_pos], count);
+  uart->rx_pos += count;
+  return (int)count;
+}
+
+const qc_lc29x_transport_s fake_uart_transport = {
+    .init = NULL,
+    .write = fake_uart_write,
+    .read = fake_uart_read,
+    .config = NULL,
+};
+
+size_t driver_heap_calls = 0;
+
+#ifdef LC29_TESTS_WRAP_MALLOC
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+  driver_heap_calls++;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  driver_heap_calls++;
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  driver_heap_calls++;
+  return __real_realloc(ptr, size);
+}
+#endif
+
+#ifdef __linux__
+int open_pty_pair(int *master, int *slave) {
+  *master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (*master < 0) {
+    return -1;
+  }
+  if (grantpt(*master) != 0 || unlockpt(*master) != 0) {
+    close(*master);
+    return -1;
+  }
+  *slave = open(ptsname(*master), O_RDWR | O_NOCTTY);
+  if (*slave < 0) {
+    close(*master);
+    return -1;
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,157 @@
+/*
+  Bulk scan benchmark: sentences per second through a recorded log, finding
+  every sentence and checking its checksum. The reference walks the log a
+  byte at a time and checks each sentence with lc29_driver_get_checksum(),
+  what an offline tool built on the driver does today; the scanner runs with
+  every kernel the CPU supports.
+
+  Usage: gnss_scan_bench [log megabytes]
+  Default: an 8 MB synthetic log, the best of BENCH_ROUNDS rounds is reported.
+*/
+
+#define _GNU_SOURCE
+
+#include "qc_lc29_driver.h"
+#include "qc_lc29_scan.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ROUNDS 5
+#define SCAN_ENTRIES 4096
+
+/* One epoch of a 1 Hz NMEA stream with DR output */
+static const char *epoch[] = {
+    "$GNGGA,092725.000,4717.113210,N,00833.915187,E,1,08,1.01,499.617,M,"
+    "48.000,M,,*77\r\n",
+    "$GNRMC,092725.000,A,4717.113210,N,00833.915187,E,0.02,84.40,160526,,,A,"
+    "V*33\r\n",
+    "$GNVTG,84.40,T,,M,0.02,N,0.04,K,A*1D\r\n",
+    "$GNGSA,A,3,01,02,03,05,07,,,,,,,,1.50,0.90,1.20,1*0D\r\n",
+    "$GPGSV,3,1,09,01,45,083,42,02,17,308,35,03,62,120,47,04,05,270,,1*68\r\n",
+    "$GPGSV,3,2,09,05,23,045,30,06,,,,07,80,000,50,08,33,190,28,1*5C\r\n",
+    "$GPGSV,3,3,09,09,12,333,25,1*53\r\n",
+    "$PQTMIMU,43275724,0.0010,-0.0020,0.9990,0.0000,0.0000,-0.5000*6C\r\n",
+};
+#define EPOCH_SENTENCES (sizeof(epoch) / sizeof(epoch[0]))
+
+static volatile size_t sink;
+
+static double now_ns(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+static int hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  return (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+}
+
+/* Byte at a time: find the '$', checksum it, compare, skip to the '\n' */
+static size_t scan_scalar(const char *log, size_t length) {
+  size_t valid = 0;
+
+  for (size_t i = 0; i < length; i++) {
+    if ('$' != log[i]) {
+      continue;
+    }
+    uint8_t checksum = lc29_driver_get_checksum(&log[i]);
+    while (i < length && '*' != log[i] && '\n' != log[i]) {
+      i++;
+    }
+    if (i + 2 < length && '*' == log[i] &&
+        checksum == (hex_value(log[i + 1]) << 4 | hex_value(log[i + 2]))) {
+      valid++;
+    }
+    while (i < length && '\n' != log[i]) {
+      i++;
+    }
+  }
+  return valid;
+}
+
+static size_t scan_bulk(const char *log, size_t length) {
+  static qc_lc29x_scan_entry_s entries[SCAN_ENTRIES];
+  size_t valid = 0;
+  size_t offset = 0;
+
+  while (offset < length) {
+    size_t consumed;
+    size_t count = lc29_scan_sentences(&log[offset], length - offset, entries,
+                                       SCAN_ENTRIES, &consumed);
+    for (size_t i = 0; i < count; i++) {
+      valid += entries[i].valid;
+    }
+    if (0 == count) {
+      break;
+    }
+    offset += consumed;
+  }
+  return valid;
+}
+
+static void bench(const char *name, size_t (*scan)(const char *, size_t),
+                  const char *log, size_t length, size_t sentences) {
+  double best = 0;
+
+  for (int round = 0; round < BENCH_ROUNDS; round++) {
+    double start = now_ns();
+    size_t valid = scan(log, length);
+    double elapsed = now_ns() - start;
+    if (valid != sentences) {
+      fprintf(stderr, "%s found %zu of %zu sentences\n", name, valid,
+              sentences);
+      exit(1);
+    }
+    if (0 == round || elapsed < best) {
+      best = elapsed;
+    }
+    sink = valid;
+  }
+  printf("%-24s %8.1f MB/s %8.2f M sentences/s\n", name,
+         (double)length / best * 1e3, (double)sentences / best * 1e3);
+}
+
+int main(int argc, char *argv[]) {
+  size_t megabytes = argc > 1 ? (size_t)atol(argv[1]) : 8;
+  size_t capacity = megabytes * 1024 * 1024;
+  char *log = malloc(capacity + 1);
+  size_t length = 0;
+  size_t sentences = 0;
+  static const struct {
+    const char *name;
+    qc_lc29x_scan_kernel_t kernel;
+  } kernels[] = {{"scan scalar", LC29_SCAN_SCALAR},
+                 {"scan SSE2", LC29_SCAN_SSE2},
+                 {"scan AVX2", LC29_SCAN_AVX2}};
+
+  if (NULL == log) {
+    return 1;
+  }
+  for (size_t i = 0;; i = (i + 1) % EPOCH_SENTENCES) {
+    size_t sentence_length = strlen(epoch[i]);
+    if (length + sentence_length > capacity) {
+      break;
+    }
+    memcpy(&log[length], epoch[i], sentence_length);
+    length += sentence_length;
+    sentences++;
+  }
+  log[length] = '\0';
+
+  bench("lc29_driver_get_checksum", scan_scalar, log, length, sentences);
+  for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+    if (lc29_scan_use_kernel(kernels[i].kernel)) {
+      bench(kernels[i].name, scan_bulk, log, length, sentences);
+    } else {
+      printf("%-24s not supported\n", kernels[i].name);
+    }
+  }
+
+  free(log);
+  return 0;
+}
@@ -6,6 +6,8 @@
 qc_lc29x_driver_response_t driverA_init(void);
 qc_lc29x_driver_response_t driverA_write(char *data, int length);
 qc_lc29x_driver_response_t driverA_read_fix_rate(char *data, int length);
+qc_lc29x_driver_response_t driverA_read_fix_rate_split(char *data,
+                                                       int length);
 qc_lc29x_driver_response_t driverA_read_min_snr(char *data, int length);
 qc_lc29x_driver_response_t driverA_config(char config);
 qc_lc29x_driver_response_t driverA_read_nmea_output_rate(char *data,
@@ -18,6 +20,16 @@ qc_lc29x_driver_response_t driverA_query_fix_rate_response(char *data,
                                                            int length);
 qc_lc29x_driver_response_t driverA_query_min_snr_response(char *data,
                                                           int length);
+qc_lc29x_driver_response_t driverA_query_min_snr_burst_response(char *data,
+                                                                int length);
+qc_lc29x_driver_response_t driverA_query_min_snr_interleaved(char *data,
+                                                             int length);
+qc_lc29x_driver_response_t driverA_read_pipelined_burst(char *data,
+                                                        int length);
+qc_lc29x_driver_response_t driverA_read_nvm_save_deferred(char *data,
+                                                          int length);
+qc_lc29x_driver_response_t driverA_read_processing_ack(char *data,
+                                                       int length);
 
 qc_lc29x_driver_response_t driverA_query_pqtm_settings(char *data, int length);
 
@@ -26,4 +38,27 @@ qc_lc29x_driver_response_t driverA_read_dr_rtk_message_output(char *data,
 
 qc_lc29x_driver_response_t driverA_query_dr_rtk_message_output(char *data,
                                                                int length);
+
+/* Transport v2 stub, one instance per simulated module */
+typedef struct {
+  const char *rx;   // bytes the module sends
+  size_t rx_pos;
+  size_t rx_chunk;  // most bytes handed out per read
+  char tx[128];     // last command written
+  size_t tx_length;
+} fake_uart_s;
+
+extern const qc_lc29x_transport_s fake_uart_transport;
+
+/*
+  Heap calls made by the code under test. Only counted when the test binary
+  is linked with --wrap=malloc/calloc/realloc (LC29_TESTS_WRAP_MALLOC).
+*/
+extern size_t driver_heap_calls;
+
+#ifdef __linux__
+/* Module side and host side of a pseudo terminal */
+int open_pty_pair(int *master, int *slave);
+#endif
+
 #endif
\ No newline at end of file